@@ -0,0 +1,150 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/* Times ClpPackedMatrix3::transposeTimes (the dual pricing kernel) with
+   old fixed blocks against blocks sized from level 2 cache with row tiling.
+   Usage -
+   benchMatrix3                  netlib 25fv47 (if NETLIBDIR known)
+   benchMatrix3 file.mps [passes]
+   benchMatrix3 -big [passes]    random model with 10M elements
+   Build with make DRIVER=benchMatrix3
+*/
+#include "ClpSimplex.hpp"
+#include "ClpPackedMatrix.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+// Random model with numberColumns columns each with numberPerColumn elements
+static void makeBig(ClpSimplex &model, int numberRows, int numberColumns,
+  int numberPerColumn)
+{
+  CoinBigIndex numberElements = static_cast< CoinBigIndex >(numberColumns) * numberPerColumn;
+  CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+  int *row = new int[numberElements];
+  double *element = new double[numberElements];
+  double *objective = new double[numberColumns];
+  double *rowLower = new double[numberRows];
+  double *rowUpper = new double[numberRows];
+  CoinBigIndex put = 0;
+  srand(1234567);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    start[iColumn] = put;
+    // mostly in a band so some locality as in real models
+    int base = static_cast< int >((static_cast< double >(iColumn) / numberColumns) * numberRows);
+    for (int j = 0; j < numberPerColumn; j++) {
+      int iRow;
+      if (j < numberPerColumn - 1)
+        iRow = (base + rand() % 1000) % numberRows;
+      else
+        iRow = rand() % numberRows;
+      row[put] = iRow;
+      element[put++] = 1.0 + (rand() % 7);
+    }
+    objective[iColumn] = 1.0 + (rand() % 11);
+  }
+  start[numberColumns] = put;
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    rowLower[iRow] = 1.0;
+    rowUpper[iRow] = COIN_DBL_MAX;
+  }
+  CoinPackedMatrix matrix(true, numberRows, numberColumns, numberElements,
+    element, row, start, NULL);
+  // remove duplicates
+  matrix.cleanMatrix();
+  model.loadProblem(matrix, NULL, NULL, objective, rowLower, rowUpper);
+  delete[] start;
+  delete[] row;
+  delete[] element;
+  delete[] objective;
+  delete[] rowLower;
+  delete[] rowUpper;
+}
+
+// Returns time for passes and sum of absolute values of result
+static double timeIt(ClpSimplex &model, ClpPackedMatrix3 &copy,
+  const double *pi, CoinIndexedVector &output, int numberPasses,
+  double &sum)
+{
+  double time1 = CoinCpuTime();
+  sum = 0.0;
+  for (int iPass = 0; iPass < numberPasses; iPass++) {
+    output.clear();
+    copy.transposeTimes(&model, pi, &output);
+    int number = output.getNumElements();
+    const double *array = output.denseVector();
+    for (int i = 0; i < number; i++)
+      sum += fabs(array[i]);
+  }
+  output.clear();
+  return CoinCpuTime() - time1;
+}
+
+int main(int argc, const char *argv[])
+{
+  ClpSimplex model;
+  int status = 0;
+  int numberPasses = 100;
+  if (argc < 2) {
+#if defined(NETLIBDIR)
+    status = model.readMps(NETLIBDIR "/25fv47.mps", true);
+#else
+    fprintf(stderr, "Do not know where to find netlib MPS files.\n");
+    exit(1);
+#endif
+  } else if (!strcmp(argv[1], "-big")) {
+    // 10M elements
+    makeBig(model, 500000, 2000000, 5);
+    numberPasses = 10;
+  } else {
+    status = model.readMps(argv[1], true);
+  }
+  if (status) {
+    fprintf(stderr, "Bad readMps\n");
+    exit(1);
+  }
+  if (argc > 2)
+    numberPasses = atoi(argv[2]);
+  int numberRows = model.numberRows();
+  int numberColumns = model.numberColumns();
+  printf("%d rows, %d columns and %d elements - %d passes\n",
+    numberRows, numberColumns,
+    static_cast< int >(model.getNumElements()), numberPasses);
+  // all slack basis
+  model.createStatus();
+  double *pi = new double[numberRows];
+  srand(7654321);
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    pi[iRow] = (rand() % 3) ? 0.0 : -1.0 + 2.0 * rand() / RAND_MAX;
+  CoinIndexedVector output;
+  output.reserve(2 * (numberRows + numberColumns) + 64);
+  // old fixed blocks and no tiling
+  ClpPackedMatrix3 oldCopy(&model, model.matrix(), 0);
+  oldCopy.sortBlocks(&model);
+  // blocks from cache size
+  ClpPackedMatrix3 newCopy(&model, model.matrix(), -1);
+  newCopy.sortBlocks(&model);
+  double sumOld, sumNew;
+  // warm up
+  timeIt(model, oldCopy, pi, output, 1, sumOld);
+  timeIt(model, newCopy, pi, output, 1, sumNew);
+  double timeOld = timeIt(model, oldCopy, pi, output, numberPasses, sumOld);
+  double timeNew = timeIt(model, newCopy, pi, output, numberPasses, sumNew);
+  printf("fixed blocks - %d blocks (max %d columns) - %g seconds\n",
+    oldCopy.numberBlocks(), oldCopy.maximumBlockSize(), timeOld);
+  printf("cache blocks - %d blocks (max %d columns) - %g seconds\n",
+    newCopy.numberBlocks(), newCopy.maximumBlockSize(), timeNew);
+  if (timeNew > 0.0)
+    printf("speedup %g\n", timeOld / timeNew);
+  if (fabs(sumOld - sumNew) > 1.0e-8 * (1.0 + fabs(sumOld))) {
+    printf("Results differ %g %g\n", sumOld, sumNew);
+    delete[] pi;
+    return 1;
+  }
+  delete[] pi;
+  return 0;
+}
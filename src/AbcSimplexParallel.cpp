@@ -1867,7 +1867,8 @@ void parallelDual5(AbcSimplexFactorization *factorization,
    2 Left Lower Transpose Unit
    3 Left Upper Transpose NonUnit
 */
-static void CoinAbcDtrsmFactor(int m, int n, double *COIN_RESTRICT a, int lda)
+static void CoinAbcDtrsmFactor(int m, int n, double *COIN_RESTRICT a,
+  double *COIN_RESTRICT b, int lda)
 {
   assert((m & (BLOCKING8 - 1)) == 0 && (n & (BLOCKING8 - 1)) == 0);
   assert(m == BLOCKING8);
@@ -1876,7 +1877,8 @@ static void CoinAbcDtrsmFactor(int m, int n, double *COIN_RESTRICT a, int lda)
      is at aBlocked+j*m+i*BLOCKING8
   */
   double *COIN_RESTRICT aBase2 = a;
-  double *COIN_RESTRICT bBase2 = aBase2 + lda * BLOCKING8;
+  // b is first column block to right of diagonal block a
+  double *COIN_RESTRICT bBase2 = b;
   for (int jj = 0; jj < n; jj += BLOCKING8) {
     double *COIN_RESTRICT bBase = bBase2;
     for (int j = jj; j < jj + BLOCKING8; j++) {
@@ -2385,6 +2387,26 @@ CoinAbcDlaswp(int n, double *COIN_RESTRICT a, int lda, int start, int end, int *
     }
   }
 }
+#define CILK_DLASWP 64 // columns per task for swaps and solve
+/* Row swaps from ipiv[start..end) for columns first to last and if
+   diagonal given solve with that unit lower block.  Column blocks
+   are independent so split in halves if allowed to go parallel */
+static void swapSolveBlocks(int first, int last, double *COIN_RESTRICT a, int lda,
+  int start, int end, int *ipiv, double *COIN_RESTRICT diagonal, int parallel)
+{
+  assert((last - first) % BLOCKING8 == 0);
+  if (parallel && last - first > CILK_DLASWP) {
+    int mid = ((first + last) >> 4) << 3;
+    cilk_spawn swapSolveBlocks(first, mid, a, lda, start, end, ipiv, diagonal, parallel);
+    swapSolveBlocks(mid, last, a, lda, start, end, ipiv, diagonal, parallel);
+    cilk_sync;
+  } else {
+    CoinAbcDlaswp(last - first, a + first * lda, lda, start, end, ipiv);
+    if (diagonal)
+      CoinAbcDtrsmFactor(BLOCKING8, last - first, diagonal,
+        a + first * lda + start * BLOCKING8, lda);
+  }
+}
 extern void CoinAbcDgemm(int m, int n, int k, double *COIN_RESTRICT a, int lda,
   double *COIN_RESTRICT b, double *COIN_RESTRICT c
 #if ABC_PARALLEL == 2
@@ -2500,6 +2522,11 @@ int CoinAbcDgetrf(int m, int n, double *COIN_RESTRICT a, int lda, int *ipiv
   if (m < BLOCKING8) {
     return CoinAbcDgetrf2(m, n, a, ipiv);
   } else {
+#if ABC_PARALLEL == 2
+    int parallel = parallelMode;
+#else
+    int parallel = 0;
+#endif
     for (int j = 0; j < n; j += BLOCKING8) {
       int start = j;
       int newSize = CoinMin(BLOCKING8, n - j);
@@ -2510,12 +2537,12 @@ int CoinAbcDgetrf(int m, int n, double *COIN_RESTRICT a, int lda, int *ipiv
         // adjust
         for (int k = start; k < end; k++)
           ipiv[k] += start;
-        // swap 0<start
-        CoinAbcDlaswp(start, a, lda, start, end, ipiv);
+        // swap 0<start - independent of rest of this step
+        cilk_spawn swapSolveBlocks(0, start, a, lda, start, end, ipiv, NULL, parallel);
         if (end < n) {
-          // swap >=end
-          CoinAbcDlaswp(n - end, a + end * lda, lda, start, end, ipiv);
-          CoinAbcDtrsmFactor(newSize, n - end, a + (start * lda + start * BLOCKING8), lda);
+          // swap >=end and solve for U
+          swapSolveBlocks(end, n, a, lda, start, end, ipiv,
+            a + (start * lda + start * BLOCKING8), parallel);
           CoinAbcDgemm(n - end, n - end, newSize,
             a + start * lda + end * BLOCKING8, lda,
             a + end * lda + start * BLOCKING8, a + end * lda + end * BLOCKING8
@@ -2525,6 +2552,7 @@ int CoinAbcDgetrf(int m, int n, double *COIN_RESTRICT a, int lda, int *ipiv
 #endif
           );
         }
+        cilk_sync;
       } else {
         return returnCode;
       }
@@ -2554,7 +2582,8 @@ void CoinAbcDgetrs(char trans, int m, double *COIN_RESTRICT a, double *COIN_REST
    2 Left Lower Transpose Unit
    3 Left Upper Transpose NonUnit
 */
-static void CoinAbcDtrsmFactor(int m, int n, long double *COIN_RESTRICT a, int lda)
+static void CoinAbcDtrsmFactor(int m, int n, long double *COIN_RESTRICT a,
+  long double *COIN_RESTRICT b, int lda)
 {
   assert((m & (BLOCKING8 - 1)) == 0 && (n & (BLOCKING8 - 1)) == 0);
   assert(m == BLOCKING8);
@@ -2563,7 +2592,8 @@ static void CoinAbcDtrsmFactor(int m, int n, long double *COIN_RESTRICT a, int l
      is at aBlocked+j*m+i*BLOCKING8
   */
   long double *COIN_RESTRICT aBase2 = a;
-  long double *COIN_RESTRICT bBase2 = aBase2 + lda * BLOCKING8;
+  // b is first column block to right of diagonal block a
+  long double *COIN_RESTRICT bBase2 = b;
   for (int jj = 0; jj < n; jj += BLOCKING8) {
     long double *COIN_RESTRICT bBase = bBase2;
     for (int j = jj; j < jj + BLOCKING8; j++) {
@@ -3072,6 +3102,25 @@ CoinAbcDlaswp(int n, long double *COIN_RESTRICT a, int lda, int start, int end,
     }
   }
 }
+/* Row swaps from ipiv[start..end) for columns first to last and if
+   diagonal given solve with that unit lower block.  Column blocks
+   are independent so split in halves if allowed to go parallel */
+static void swapSolveBlocks(int first, int last, long double *COIN_RESTRICT a, int lda,
+  int start, int end, int *ipiv, long double *COIN_RESTRICT diagonal, int parallel)
+{
+  assert((last - first) % BLOCKING8 == 0);
+  if (parallel && last - first > CILK_DLASWP) {
+    int mid = ((first + last) >> 4) << 3;
+    cilk_spawn swapSolveBlocks(first, mid, a, lda, start, end, ipiv, diagonal, parallel);
+    swapSolveBlocks(mid, last, a, lda, start, end, ipiv, diagonal, parallel);
+    cilk_sync;
+  } else {
+    CoinAbcDlaswp(last - first, a + first * lda, lda, start, end, ipiv);
+    if (diagonal)
+      CoinAbcDtrsmFactor(BLOCKING8, last - first, diagonal,
+        a + first * lda + start * BLOCKING8, lda);
+  }
+}
 extern void CoinAbcDgemm(int m, int n, int k, long double *COIN_RESTRICT a, int lda,
   long double *COIN_RESTRICT b, long double *COIN_RESTRICT c
 #if ABC_PARALLEL == 2
@@ -3187,6 +3236,11 @@ int CoinAbcDgetrf(int m, int n, long double *COIN_RESTRICT a, int lda, int *ipiv
   if (m < BLOCKING8) {
     return CoinAbcDgetrf2(m, n, a, ipiv);
   } else {
+#if ABC_PARALLEL == 2
+    int parallel = parallelMode;
+#else
+    int parallel = 0;
+#endif
     for (int j = 0; j < n; j += BLOCKING8) {
       int start = j;
       int newSize = CoinMin(BLOCKING8, n - j);
@@ -3197,12 +3251,12 @@ int CoinAbcDgetrf(int m, int n, long double *COIN_RESTRICT a, int lda, int *ipiv
         // adjust
         for (int k = start; k < end; k++)
           ipiv[k] += start;
-        // swap 0<start
-        CoinAbcDlaswp(start, a, lda, start, end, ipiv);
+        // swap 0<start - independent of rest of this step
+        cilk_spawn swapSolveBlocks(0, start, a, lda, start, end, ipiv, NULL, parallel);
         if (end < n) {
-          // swap >=end
-          CoinAbcDlaswp(n - end, a + end * lda, lda, start, end, ipiv);
-          CoinAbcDtrsmFactor(newSize, n - end, a + (start * lda + start * BLOCKING8), lda);
+          // swap >=end and solve for U
+          swapSolveBlocks(end, n, a, lda, start, end, ipiv,
+            a + (start * lda + start * BLOCKING8), parallel);
           CoinAbcDgemm(n - end, n - end, newSize,
             a + start * lda + end * BLOCKING8, lda,
             a + end * lda + start * BLOCKING8, a + end * lda + end * BLOCKING8
@@ -3212,6 +3266,7 @@ int CoinAbcDgetrf(int m, int n, long double *COIN_RESTRICT a, int lda, int *ipiv
 #endif
           );
         }
+        cilk_sync;
       } else {
         return returnCode;
       }
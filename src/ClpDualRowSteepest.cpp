@@ -3,11 +3,16 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "CoinPragma.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "CoinIndexedVector.hpp"
 #include "ClpFactorization.hpp"
 #include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
 #include <cstdio>
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -26,6 +31,7 @@ ClpDualRowSteepest::ClpDualRowSteepest(int mode)
   , alternateWeights_(NULL)
   , savedWeights_(NULL)
   , dubiousWeights_(NULL)
+  , exactWeightsTime_(0.0)
 {
   type_ = 2 + 64 * mode;
 }
@@ -39,6 +45,7 @@ ClpDualRowSteepest::ClpDualRowSteepest(const ClpDualRowSteepest &rhs)
   state_ = rhs.state_;
   mode_ = rhs.mode_;
   persistence_ = rhs.persistence_;
+  exactWeightsTime_ = rhs.exactWeightsTime_;
   model_ = rhs.model_;
   if ((model_ && model_->whatsChanged() & 1) != 0) {
     int number = model_->numberRows();
@@ -105,6 +112,7 @@ ClpDualRowSteepest::operator=(const ClpDualRowSteepest &rhs)
     state_ = rhs.state_;
     mode_ = rhs.mode_;
     persistence_ = rhs.persistence_;
+    exactWeightsTime_ = rhs.exactWeightsTime_;
     model_ = rhs.model_;
     delete[] weights_;
     delete[] dubiousWeights_;
@@ -153,6 +161,7 @@ void ClpDualRowSteepest::fill(const ClpDualRowSteepest &rhs)
   state_ = rhs.state_;
   mode_ = rhs.mode_;
   persistence_ = rhs.persistence_;
+  exactWeightsTime_ = rhs.exactWeightsTime_;
   assert(model_->numberRows() == rhs.model_->numberRows());
   model_ = rhs.model_;
   assert(model_);
@@ -206,6 +215,89 @@ void ClpDualRowSteepest::fill(const ClpDualRowSteepest &rhs)
   }
 }
 // Returns pivot row, -1 if none
+#if ABOCA_LITE
+/* Chooses best infeasibility/weight in part of infeasibility list
+   (numberAdded is last pivot row on entry and chosen row on exit) */
+static void
+choosePivotBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT infeas = info.infeas;
+  const int *COIN_RESTRICT index = info.which;
+  const double *COIN_RESTRICT weights = info.work;
+  const int *COIN_RESTRICT pivotVariable = info.pivotVariable;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const double *COIN_RESTRICT solution = info.solution;
+  const double *COIN_RESTRICT lower = info.lower;
+  const double *COIN_RESTRICT upper = info.upper;
+  double tolerance = info.tolerance;
+  int lastPivotRow = info.numberAdded;
+  double largest = 0.0;
+  int chosenRow = -1;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int i = first; i < last; i++) {
+    int iRow = index[i];
+    double value = infeas[iRow];
+    if (value > tolerance) {
+      double weight = CoinMin(weights[iRow], 1.0e50);
+      if (value > largest * weight) {
+        // make last pivot row last resort choice
+        if (iRow == lastPivotRow) {
+          if (value * 1.0e-10 < largest * weight)
+            continue;
+          else
+            value *= 1.0e-10;
+        }
+        int iSequence = pivotVariable[iRow];
+        if ((status[iSequence] & 64) == 0) {
+          if (solution[iSequence] > upper[iSequence] + tolerance || solution[iSequence] < lower[iSequence] - tolerance) {
+            chosenRow = iRow;
+            largest = value / weight;
+          }
+        }
+      }
+    }
+  }
+  info.numberAdded = chosenRow;
+  info.bestPossible = largest;
+}
+/* Updates weights for part of updated column
+   (old weights saved in same position in work3) */
+static void
+updateWeightsBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT work = info.cost;
+  const int *COIN_RESTRICT which = info.pivotVariable;
+  const double *COIN_RESTRICT work2 = info.lower;
+  const int *COIN_RESTRICT pivotColumn = info.row;
+  double *COIN_RESTRICT weights = info.solution;
+  double *COIN_RESTRICT work3 = info.spare;
+  int *COIN_RESTRICT which3 = info.index;
+  double norm = info.theta;
+  double multiplier = info.changeObj;
+  int pivotRow = info.numberColumns;
+  double alpha = 0.0;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int i = first; i < last; i++) {
+    int iRow = which[i];
+    double theta = work[i];
+    if (iRow == pivotRow)
+      alpha = theta;
+    double devex = weights[iRow];
+    work3[i] = devex; // save old
+    which3[i] = iRow;
+    // transform to match spare
+    int jRow = pivotColumn ? pivotColumn[iRow] : iRow;
+    double value = work2[jRow];
+    devex += theta * (theta * norm + value * multiplier);
+    if (devex < DEVEX_TRY_NORM)
+      devex = DEVEX_TRY_NORM;
+    weights[iRow] = devex;
+  }
+  info.upperTheta = alpha;
+}
+#endif
 int ClpDualRowSteepest::pivotRow()
 {
   assert(model_);
@@ -310,7 +402,43 @@ int ClpDualRowSteepest::pivotRow()
   start[3] = start[0];
   //double largestWeight=0.0;
   //double smallestWeight=1.0e100;
-  for (iPass = 0; iPass < 2; iPass++) {
+  int firstPass = 0;
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  if (numberThreads > 1 && numberWanted > number && number > 10000 * numberThreads) {
+    // full scan of long list - do in parallel
+    clpTempInfo info[ABOCA_LITE];
+    int chunk = (number + numberThreads - 1) / numberThreads;
+    int n = 0;
+    for (i = 0; i < numberThreads; i++) {
+      info[i].infeas = infeas;
+      info[i].which = index;
+      info[i].work = weights_;
+      info[i].pivotVariable = pivotVariable;
+      info[i].status = model_->statusArray();
+      info[i].solution = solution;
+      info[i].lower = lower;
+      info[i].upper = upper;
+      info[i].tolerance = tolerance;
+      info[i].numberAdded = lastPivotRow;
+      info[i].startColumn = n;
+      info[i].numberToDo = CoinMin(chunk, number - n);
+      n += info[i].numberToDo;
+    }
+    for (i = 0; i < numberThreads; i++)
+      cilk_spawn choosePivotBit(info[i]);
+    cilk_sync;
+    for (i = 0; i < numberThreads; i++) {
+      if (info[i].numberAdded >= 0 && info[i].bestPossible > largest) {
+        largest = info[i].bestPossible;
+        chosenRow = info[i].numberAdded;
+      }
+    }
+    // skip serial passes
+    firstPass = 2;
+  }
+#endif
+  for (iPass = firstPass; iPass < 2; iPass++) {
     int end = start[2 * iPass + 1];
     for (i = start[2 * iPass]; i < end; i++) {
       iRow = index[i];
@@ -546,7 +674,41 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     double *work3 = alternateWeights_->denseVector();
     int *which3 = alternateWeights_->getIndices();
     const int *pivotColumn = model_->factorization()->pivotColumn();
-    for (i = 0; i < numberNonZero; i++) {
+    int first = 0;
+#if ABOCA_LITE
+    int numberThreads = abcState();
+    if (numberThreads > 1 && numberNonZero > 10000 * numberThreads) {
+      // rows are distinct so slices can be updated in parallel
+      clpTempInfo info[ABOCA_LITE];
+      int chunk = (numberNonZero + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (i = 0; i < numberThreads; i++) {
+        info[i].cost = work;
+        info[i].pivotVariable = which;
+        info[i].lower = work2;
+        info[i].row = permute ? pivotColumn : NULL;
+        info[i].solution = weights_;
+        info[i].spare = work3;
+        info[i].index = which3;
+        info[i].theta = norm;
+        info[i].changeObj = multiplier;
+        info[i].numberColumns = pivotRow;
+        info[i].startColumn = n;
+        info[i].numberToDo = CoinMin(chunk, numberNonZero - n);
+        n += info[i].numberToDo;
+      }
+      for (i = 0; i < numberThreads; i++)
+        cilk_spawn updateWeightsBit(info[i]);
+      cilk_sync;
+      for (i = 0; i < numberThreads; i++) {
+        if (info[i].upperTheta)
+          alpha = info[i].upperTheta;
+      }
+      nSave = numberNonZero;
+      first = numberNonZero; // skip serial loop
+    }
+#endif
+    for (i = first; i < numberNonZero; i++) {
       int iRow = which[i];
       double theta = work[i];
       if (iRow == pivotRow)
@@ -858,12 +1020,8 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
       alternateWeights_ = new CoinIndexedVector();
       // enough space so can use it for factorization
       alternateWeights_->reserve(numberRows + model_->factorization()->maximumPivots());
-      if (mode_ != 1 || mode == 5) {
+      if ((mode_ != 1 && exactWeightsTime_ <= 0.0) || mode == 5) {
       } else {
-        CoinIndexedVector *temp = new CoinIndexedVector();
-        temp->reserve(numberRows + model_->factorization()->maximumPivots());
-        double *array = alternateWeights_->denseVector();
-        int *which = alternateWeights_->getIndices();
         int firstRow = 0;
         int lastRow = numberRows;
         if (mode == 7) {
@@ -871,24 +1029,13 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
           firstRow = model->spareIntArray_[0];
           lastRow = model->spareIntArray_[1];
         }
-        for (i = firstRow; i < lastRow; i++) {
-          double value = 0.0;
-          array[0] = 1.0;
-          which[0] = i;
-          alternateWeights_->setNumElements(1);
-          alternateWeights_->setPackedMode(true);
-          model_->factorization()->updateColumnTranspose(temp,
-            alternateWeights_);
-          int number = alternateWeights_->getNumElements();
-          int j;
-          for (j = 0; j < number; j++) {
-            value += array[j] * array[j];
-            array[j] = 0.0;
-          }
-          alternateWeights_->setNumElements(0);
-          weights_[i] = value;
+        // full mode always does exact weights
+        double timeBudget = (mode_ == 1) ? COIN_DBL_MAX : exactWeightsTime_;
+        if (!computeExactWeights(firstRow, lastRow, timeBudget)) {
+          // out of time - go back to devex
+          for (i = firstRow; i < lastRow; i++)
+            weights_[i] = 1.0;
         }
-        delete temp;
       }
       // create saved weights (not really indexedvector)
       savedWeights_ = new CoinIndexedVector();
@@ -1035,21 +1182,112 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
   // see where coming from
   if (mode == 2 && !model->numberIterations()) {
     int options = model->specialOptions();
-    if ((options & 16384) != 0 && true) {
-      // fast of some sort - could be clever???
-      // for now initialize
-      if ((options & 524288) != 0 && false) {
-        // fathom
-        for (int i = 0; i < numberRows; i++)
-          weights_[i] = 1.0;
-      } else if (true) {
-        // strong
+    if ((options & 16384) != 0) {
+      // fast of some sort - restored weights are stale
+      if (exactWeightsTime_ <= 0.0
+        || !computeExactWeights(0, numberRows, exactWeightsTime_)) {
+        // not asked for exact weights or out of time - initialize
         for (int i = 0; i < numberRows; i++)
           weights_[i] = 1.0;
       }
     }
   }
 }
+/* Exact weights for rows firstRow to lastRow-1 - BTRANs done two
+   rows at a time.  Stops if wall clock passes endTime, numberDone
+   says how far got */
+static void
+exactWeightsBit(ClpFactorization *factorization, double *weights,
+  int firstRow, int lastRow, int size, double endTime, int *numberDone)
+{
+  CoinIndexedVector temp;
+  temp.reserve(size);
+  CoinIndexedVector work;
+  work.reserve(size);
+  CoinIndexedVector work2;
+  work2.reserve(size);
+  double *array = work.denseVector();
+  int *which = work.getIndices();
+  double *array2 = work2.denseVector();
+  int *which2 = work2.getIndices();
+  int iRow;
+  for (iRow = firstRow; iRow < lastRow; iRow += 2) {
+    if (((iRow - firstRow) & 63) == 0 && endTime < COIN_DBL_MAX
+      && CoinWallclockTime() > endTime)
+      break;
+    array[0] = 1.0;
+    which[0] = iRow;
+    work.setNumElements(1);
+    work.setPackedMode(true);
+    if (iRow + 1 < lastRow) {
+      array2[0] = 1.0;
+      which2[0] = iRow + 1;
+      work2.setNumElements(1);
+      work2.setPackedMode(true);
+      factorization->updateTwoColumnsTranspose(&temp, &work, &work2);
+      double value = 0.0;
+      int number = work2.getNumElements();
+      for (int j = 0; j < number; j++) {
+        value += array2[j] * array2[j];
+        array2[j] = 0.0;
+      }
+      work2.setNumElements(0);
+      weights[iRow + 1] = value;
+    } else {
+      factorization->updateColumnTranspose(&temp, &work);
+    }
+    double value = 0.0;
+    int number = work.getNumElements();
+    for (int j = 0; j < number; j++) {
+      value += array[j] * array[j];
+      array[j] = 0.0;
+    }
+    work.setNumElements(0);
+    weights[iRow] = value;
+  }
+  *numberDone = CoinMin(iRow, lastRow) - firstRow;
+}
+// Computes exact weights - false if out of time
+bool ClpDualRowSteepest::computeExactWeights(int firstRow, int lastRow,
+  double timeBudget)
+{
+  ClpFactorization *factorization = model_->factorization();
+  int size = model_->numberRows() + factorization->maximumPivots();
+  double endTime = COIN_DBL_MAX;
+  if (timeBudget < COIN_DBL_MAX)
+    endTime = CoinWallclockTime() + timeBudget;
+  int numberToDo = lastRow - firstRow;
+  int numberDone = 0;
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  if (numberThreads > 1 && numberToDo > 1000 * numberThreads && !factorization->networkBasis()) {
+    // work areas are in factorization so each thread needs a copy
+    ClpFactorization *copy[ABOCA_LITE];
+    int done[ABOCA_LITE];
+    int chunk = (numberToDo + numberThreads - 1) / numberThreads;
+    for (int i = 0; i < numberThreads; i++)
+      copy[i] = i ? new ClpFactorization(*factorization) : factorization;
+    int n = firstRow;
+    for (int i = 0; i < numberThreads; i++) {
+      int nThis = CoinMin(chunk, lastRow - n);
+      cilk_spawn exactWeightsBit(copy[i], weights_, n, n + nThis, size,
+        endTime, done + i);
+      n += nThis;
+    }
+    cilk_sync;
+    for (int i = 0; i < numberThreads; i++) {
+      numberDone += done[i];
+      if (i)
+        delete copy[i];
+    }
+  } else
+#endif
+  {
+    exactWeightsBit(factorization, weights_, firstRow, lastRow, size,
+      endTime, &numberDone);
+  }
+  return numberDone == numberToDo;
+}
 // Pass in saved weights
 void ClpDualRowSteepest::passInSavedWeights(const CoinIndexedVector *saved)
 {
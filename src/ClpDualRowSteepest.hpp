@@ -123,11 +123,26 @@ public:
   {
     return persistence_;
   }
+  /** Time (seconds) allowed for computing exact initial weights when
+      mode is not full (e.g. warm starts in branch and bound).  Rows are
+      shared over threads each with own copy of factorization.  If time
+      runs out devex weights (1.0) are used.  0.0 (default) is off */
+  inline void setExactWeightsTime(double value)
+  {
+    exactWeightsTime_ = value;
+  }
+  inline double exactWeightsTime() const
+  {
+    return exactWeightsTime_;
+  }
   //@}
 
   //---------------------------------------------------------------------------
 
 protected:
+  /** Computes exact weights for rows firstRow to lastRow-1.
+      Returns false if time budget exceeded (then not all set) */
+  bool computeExactWeights(int firstRow, int lastRow, double timeBudget);
   ///@name Protected member data
   /** Status
          0) Normal
@@ -150,6 +165,8 @@ protected:
   CoinIndexedVector *savedWeights_;
   /// Dubious weights
   int *dubiousWeights_;
+  /// Time allowed for exact initial weights (0.0 off)
+  double exactWeightsTime_;
   //@}
 };
 
@@ -714,6 +714,11 @@ int ClpFactorization::factorize(ClpSimplex *model,
 #endif
   return status_;
 }
+// Factorizes given basis without touching model - not in this version
+int ClpFactorization::factorizeBasis(ClpSimplex *, int *)
+{
+  return -1;
+}
 /* Replaces one Column to basis,
    returns 0=OK, 1=Probably OK, 2=singular, 3=no room
    If checkBeforeModifying is true will do all accuracy checks
@@ -1170,6 +1175,10 @@ ClpFactorization::ClpFactorization()
   goOslThreshold_ = -1;
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
+  backend_ = -1;
+  autoRows_ = -1;
+  updateScheme_ = 0;
+  refactorIncrease_ = 1.1;
   doStatistics_ = true;
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
 }
@@ -1193,6 +1202,10 @@ ClpFactorization::ClpFactorization(const ClpFactorization &rhs,
   goOslThreshold_ = rhs.goOslThreshold_;
   goDenseThreshold_ = rhs.goDenseThreshold_;
   goSmallThreshold_ = rhs.goSmallThreshold_;
+  backend_ = rhs.backend_;
+  autoRows_ = rhs.autoRows_;
+  updateScheme_ = rhs.updateScheme_;
+  refactorIncrease_ = rhs.refactorIncrease_;
   doStatistics_ = rhs.doStatistics_;
   int goDense = 0;
 #ifdef CLP_REUSE_ETAS
@@ -1273,6 +1286,10 @@ ClpFactorization::ClpFactorization(const CoinFactorization &rhs)
   goOslThreshold_ = -1;
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
+  backend_ = -1;
+  autoRows_ = -1;
+  updateScheme_ = 0;
+  refactorIncrease_ = 1.1;
   doStatistics_ = true;
   assert(!coinFactorizationA_ || !coinFactorizationB_);
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
@@ -1293,6 +1310,10 @@ ClpFactorization::ClpFactorization(const CoinOtherFactorization &rhs)
   goOslThreshold_ = -1;
   goDenseThreshold_ = -1;
   goSmallThreshold_ = -1;
+  backend_ = -1;
+  autoRows_ = -1;
+  updateScheme_ = 0;
+  refactorIncrease_ = 1.1;
   doStatistics_ = true;
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(1);
@@ -1337,6 +1358,10 @@ ClpFactorization::operator=(const ClpFactorization &rhs)
     goOslThreshold_ = rhs.goOslThreshold_;
     goDenseThreshold_ = rhs.goDenseThreshold_;
     goSmallThreshold_ = rhs.goSmallThreshold_;
+    backend_ = rhs.backend_;
+    autoRows_ = rhs.autoRows_;
+    updateScheme_ = rhs.updateScheme_;
+    refactorIncrease_ = rhs.refactorIncrease_;
     doStatistics_ = rhs.doStatistics_;
     memcpy(&shortestAverage_, &rhs.shortestAverage_, 3 * (sizeof(double) + sizeof(int)));
     if (rhs.coinFactorizationA_) {
@@ -1415,6 +1440,7 @@ void ClpFactorization::forceOtherFactorization(int which)
 {
   delete coinFactorizationB_;
   forceB_ = 0;
+  backend_ = -1;
   coinFactorizationB_ = NULL;
   if (which > 0 && which < 4) {
     delete coinFactorizationA_;
@@ -1443,6 +1469,74 @@ void ClpFactorization::forceOtherFactorization(int which)
     goSmallThreshold_ = -1;
   }
 }
+// Runtime choice of factorization code
+void ClpFactorization::setBackend(int which)
+{
+  autoRows_ = -1;
+  if (which < 0 || which > 3) {
+    backend_ = which;
+    return; // automatic chosen at factorize time
+  }
+  // keep settings
+  int saveMaximumPivots = maximumPivots();
+  double savePivotTolerance = pivotTolerance();
+  double saveZeroTolerance = zeroTolerance();
+  if (which != backendInUse() || forceB_ != which)
+    forceOtherFactorization(which);
+  maximumPivots(saveMaximumPivots);
+  pivotTolerance(savePivotTolerance);
+  zeroTolerance(saveZeroTolerance);
+  setUpdateScheme(updateScheme_);
+  backend_ = which;
+}
+// Backend actually in use (0 normal, 1 dense, 2 small, 3 osl)
+int ClpFactorization::backendInUse() const
+{
+  if (!coinFactorizationB_)
+    return 0;
+  else if (dynamic_cast< CoinDenseFactorization * >(coinFactorizationB_))
+    return 1;
+#if COINUTILS_BIGINDEX_IS_INT
+  else if (dynamic_cast< CoinSimpFactorization * >(coinFactorizationB_))
+    return 2;
+  else if (dynamic_cast< CoinOslFactorization * >(coinFactorizationB_))
+    return 3;
+#endif
+  else
+    return 0;
+}
+// Chooses backend from model statistics
+int ClpFactorization::chooseBackend(const ClpSimplex *model) const
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  const ClpMatrixBase *matrix = model->clpMatrix();
+  if (!numberRows || !numberColumns || !matrix || matrix->type() == 11)
+    return 0; // network basis is special
+  double numberElements = static_cast< double >(matrix->getNumElements());
+  // elements per column and density of whole matrix
+  double perColumn = numberElements / numberColumns;
+  double density = perColumn / numberRows;
+  int which = 0;
+  if (numberRows <= 100 || (numberRows <= 500 && density > 0.1)) {
+    // dense code has no overhead for small or nearly full bases
+    which = 1;
+#if COINUTILS_BIGINDEX_IS_INT
+  } else if (numberRows <= 5000 && perColumn >= 10.0 && density > 0.005) {
+    // fairly dense columns - osl code handles fill well
+    which = 3;
+#endif
+  }
+  // network and hypersparse stay with CoinFactorization
+  return which;
+}
+// Update scheme - 0 Forrest-Tomlin, 1 product form
+void ClpFactorization::setUpdateScheme(int value)
+{
+  updateScheme_ = value;
+  if (coinFactorizationA_)
+    coinFactorizationA_->setForrestTomlin(value == 0);
+}
 #ifdef CLP_FACTORIZATION_NEW_TIMING
 #ifdef CLP_FACTORIZATION_INSTRUMENT
 extern double externalTimeStart;
@@ -1507,7 +1601,6 @@ static double weightRest = 1.0;
 static double weightFactL = 30.0;
 static double weightFactDense = 0.1;
 static double weightNrows = 10.0;
-static double increaseNeeded = 1.1;
 static double constWeightIterate = 1.0;
 static double weightNrowsIterate = 3.0;
 #else
@@ -1517,7 +1610,6 @@ static double weightNrowsIterate = 3.0;
 #define weightFactL 30.0
 #define weightFactDense 0.1
 #define weightNrows 10.0
-#define increaseNeeded 1.1
 #define constWeightIterate 1.0
 #define weightNrowsIterate 3.0
 #endif
@@ -1541,14 +1633,16 @@ bool ClpFactorization::timeToRefactorize() const
           readTwiddle = true;
           char *environ = getenv("CLP_TWIDDLE");
           if (environ) {
+            // seventh value was increaseNeeded - now refactorIncrease_
+            double notUsed;
             sscanf(environ, "%lg %lg %lg %lg %lg %lg %lg %lg %lg",
               &weightIncU, &weightR, &weightRest, &weightFactL,
-              &weightFactDense, &weightNrows, &increaseNeeded,
+              &weightFactDense, &weightNrows, &notUsed,
               &constWeightIterate, &weightNrowsIterate);
           }
-          printf("weightIncU %g, weightR %g, weightRest %g, weightFactL %g, weightFactDense %g, weightNrows %g increaseNeeded %g constWeightIterate %g weightNrowsIterate %g\n",
+          printf("weightIncU %g, weightR %g, weightRest %g, weightFactL %g, weightFactDense %g, weightNrows %g constWeightIterate %g weightNrowsIterate %g\n",
             weightIncU, weightR, weightRest, weightFactL,
-            weightFactDense, weightNrows, increaseNeeded,
+            weightFactDense, weightNrows,
             constWeightIterate, weightNrowsIterate);
         }
 #endif
@@ -1579,7 +1673,7 @@ bool ClpFactorization::timeToRefactorize() const
       lengthU,lengthL,lengthR,nnd,average);
 #endif
       shortestAverage_ = CoinMin(shortestAverage_, average);
-      if (average > increaseNeeded * shortestAverage_ && coinFactorizationA_->pivots() > 30) {
+      if (average > refactorIncrease_ * shortestAverage_ && coinFactorizationA_->pivots() > 30) {
         //printf("PIVX %d nrow %d startU %d now %d L %d R %d dense %g average %g\n",
         //numberPivots,numberRows,effectiveStartNumberU_,
         //lengthU,lengthL,lengthR,nnd,average);
@@ -1659,6 +1753,15 @@ int ClpFactorization::factorize(ClpSimplex *model,
   int numberColumns = model->numberColumns();
   if (!numberRows)
     return 0;
+  if (backend_ == 4 && autoRows_ != numberRows && !pivots()) {
+    // automatic choice of factorization code
+    int which = chooseBackend(model);
+    if (which != backendInUse()) {
+      setBackend(which);
+      backend_ = 4;
+    }
+    autoRows_ = numberRows;
+  }
 #ifdef CLP_FACTORIZATION_INSTRUMENT
   factorization_instrument(-1);
   if (!timeInUpdate) {
@@ -2574,6 +2677,120 @@ scaledDense,scaledDense_2,scaledL,scaledR,scaledU\n");
 #endif
   return coinFactorizationA_->status();
 }
+/* Factorizes given basis without touching model status or arrays
+   so can be done on another thread while model iterates.
+   Returns 0 okay, -1 singular or not possible */
+int ClpFactorization::factorizeBasis(ClpSimplex *model, int *pivotVariable)
+{
+  ClpMatrixBase *matrix = model->clpMatrix();
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+#ifndef SLIM_CLP
+  if (networkBasis_)
+    return -1;
+#endif
+  if (!coinFactorizationA_ || matrix->type() != 1 || matrix->rhsOffset(model)
+    || model->algorithm() == 2 || !numberRows)
+    return -1;
+  // If too many compressions increase area
+  if (coinFactorizationA_->pivots() > 1 && coinFactorizationA_->numberCompressions() * 10 > coinFactorizationA_->pivots() + 10) {
+    coinFactorizationA_->areaFactor(coinFactorizationA_->areaFactor() * 1.1);
+  }
+  // own copy as model arrays may be in use
+  int *pivotTemp = new int[numberRows];
+  int numberRowBasic = 0;
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = pivotVariable[i];
+    if (iSequence >= numberColumns)
+      pivotTemp[numberRowBasic++] = iSequence - numberColumns;
+  }
+  int numberBasic = numberRowBasic;
+  for (int i = 0; i < numberRows; i++) {
+    int iSequence = pivotVariable[i];
+    if (iSequence >= 0 && iSequence < numberColumns)
+      pivotTemp[numberBasic++] = iSequence;
+  }
+  if (numberBasic != numberRows) {
+    delete[] pivotTemp;
+    return -1;
+  }
+  int numberColumnBasic = numberBasic - numberRowBasic;
+  coinFactorizationA_->setStatus(-99);
+  while (coinFactorizationA_->status() == -99) {
+    coinFactorizationA_->gutsOfDestructor();
+    coinFactorizationA_->gutsOfInitialize(2);
+    int numberElements = numberRowBasic
+      + matrix->countBasis(pivotTemp + numberRowBasic, numberColumnBasic);
+    numberElements = 3 * numberBasic + 3 * numberElements + 20000;
+    coinFactorizationA_->getAreas(numberRows, numberBasic, numberElements,
+      2 * numberElements);
+    // Fill in counts so we can skip part of preProcess
+    int *numberInRow = coinFactorizationA_->numberInRow();
+    int *numberInColumn = coinFactorizationA_->numberInColumn();
+    CoinZeroN(numberInRow, coinFactorizationA_->numberRows() + 1);
+    CoinZeroN(numberInColumn, coinFactorizationA_->maximumColumnsExtra() + 1);
+    CoinFactorizationDouble *elementU = coinFactorizationA_->elementU();
+    int *indexRowU = coinFactorizationA_->indexRowU();
+    int *startColumnU = coinFactorizationA_->startColumnU();
+#ifndef COIN_FAST_CODE
+    double slackValue = coinFactorizationA_->slackValue();
+#endif
+    for (int i = 0; i < numberRowBasic; i++) {
+      int iRow = pivotTemp[i];
+      indexRowU[i] = iRow;
+      startColumnU[i] = i;
+      elementU[i] = slackValue;
+      numberInRow[iRow] = 1;
+      numberInColumn[i] = 1;
+    }
+    startColumnU[numberRowBasic] = numberRowBasic;
+    matrix->fillBasis(model,
+      pivotTemp + numberRowBasic,
+      numberColumnBasic,
+      indexRowU,
+      startColumnU + numberRowBasic,
+      numberInRow,
+      numberInColumn + numberRowBasic,
+      elementU);
+    numberElements = startColumnU[numberBasic - 1]
+      + numberInColumn[numberBasic - 1];
+#ifdef CLP_FACTORIZATION_NEW_TIMING
+    lastNumberPivots_ = 0;
+    effectiveStartNumberU_ = numberElements - numberRows;
+#endif
+    coinFactorizationA_->setNumberElementsU(numberElements);
+    if (coinFactorizationA_->biasLU() >= 3)
+      coinFactorizationA_->preProcess(2);
+    else
+      coinFactorizationA_->preProcess(3); // no row copy
+    coinFactorizationA_->factor();
+#ifdef CLP_FACTORIZATION_NEW_TIMING
+    endLengthU_ = coinFactorizationA_->numberElements() - coinFactorizationA_->numberDense() * coinFactorizationA_->numberDense()
+      - coinFactorizationA_->numberElementsL();
+#endif
+    if (coinFactorizationA_->status() == -99) {
+      // get more memory
+      coinFactorizationA_->areaFactor(2.0 * coinFactorizationA_->areaFactor());
+    }
+  }
+  int returnCode = -1;
+  if (coinFactorizationA_->status() == 0) {
+    const int *permuteBack = coinFactorizationA_->permuteBack();
+    const int *back = coinFactorizationA_->pivotColumnBack();
+    // Redo pivot order as in factorize
+    int i;
+    for (i = 0; i < numberRowBasic; i++)
+      pivotVariable[permuteBack[back[i]]] = pivotTemp[i] + numberColumns;
+    for (; i < numberRows; i++)
+      pivotVariable[permuteBack[back[i]]] = pivotTemp[i];
+    ClpDisjointCopyN(coinFactorizationA_->permute(), numberRows, coinFactorizationA_->pivotColumn());
+    ClpDisjointCopyN(coinFactorizationA_->permuteBack(), numberRows, coinFactorizationA_->pivotColumnBack());
+    coinFactorizationA_->checkSparse();
+    returnCode = 0;
+  }
+  delete[] pivotTemp;
+  return returnCode;
+}
 /* Replaces one Column in basis,
    returns 0=OK, 1=Probably OK, 2=singular, 3=no room
    If checkBeforeModifying is true will do all accuracy checks
@@ -2599,12 +2816,8 @@ int ClpFactorization::replaceColumn(const ClpSimplex *model,
     int nOld = 0;
     int nNew = 0;
     int seq;
-#if COINUTILS_BIGINDEX_IS_INT && CLP_POOL_MATRIX == 0
-    const CoinPackedMatrix *matrix = model->matrix();
-    const int *columnLength = matrix->getVectorLengths();
-#else
+    // not model->matrix() as that would expand a ClpPoolMatrix
     const int *columnLength = model->clpMatrix()->getVectorLengths();
-#endif
     seq = model->sequenceIn();
     if (seq >= 0 && seq < model->numberColumns() + model->numberRows()) {
       if (seq < model->numberColumns()) {
@@ -52,6 +52,13 @@ public:
      and ones thrown out have -1
      returns 0 -okay, -1 singular, -2 too many in basis, -99 memory */
   int factorize(ClpSimplex *model, int solveType, bool valuesPass);
+  /** Factorizes a given basis without touching model status or arrays
+     so can be done on another thread while model iterates.
+     On input pivotVariable has the numberRows basic sequences (in any
+     order), on output (if okay) the pivot order as factorize would
+     leave in model.  Only for CoinFactorization and a packed matrix.
+     returns 0 -okay, -1 singular or not possible */
+  int factorizeBasis(ClpSimplex *model, int *pivotVariable);
   //@}
 
   /**@name Constructors, destructor */
@@ -398,9 +405,10 @@ public:
     if (coinFactorizationA_)
       coinFactorizationA_->setBiasLU(value);
   }
-  /// true if Forrest Tomlin update, false if PFI
+  /// true if Forrest Tomlin update, false if PFI (kept over setBackend)
   inline void setForrestTomlin(bool value)
   {
+    updateScheme_ = value ? 0 : 1;
     if (coinFactorizationA_)
       coinFactorizationA_->setForrestTomlin(value);
   }
@@ -417,6 +425,46 @@ public:
   }
   /// If nonzero force use of 1,dense 2,small 3,osl
   void forceOtherFactorization(int which);
+  /** Runtime choice of factorization code (backend) -
+      0 - normal CoinFactorization (with dense/small/osl thresholds if set)
+      1 - dense (CoinDenseFactorization)
+      2 - small (CoinSimpFactorization)
+      3 - CoinOslFactorization
+      4 - automatic - chosen by chooseBackend when a model with a
+          different number of rows is factorized.
+      Maximum pivots, tolerances and update scheme are kept */
+  void setBackend(int which);
+  /// Backend asked for (-1 if never set - see setBackend)
+  inline int backend() const
+  {
+    return backend_;
+  }
+  /// Backend actually in use (0 normal, 1 dense, 2 small, 3 osl)
+  int backendInUse() const;
+  /** Chooses backend from model statistics.
+      Small bases, or quite small dense ones, go to dense code, medium
+      sized problems with dense columns to osl code and the rest
+      (including hypersparse) to CoinFactorization */
+  int chooseBackend(const ClpSimplex *model) const;
+  /** Update scheme - 0 Forrest-Tomlin (default), 1 product form.
+      Only CoinFactorization has a choice, other codes ignore */
+  void setUpdateScheme(int value);
+  inline int updateScheme() const
+  {
+    return updateScheme_;
+  }
+  /** How much average cost per iteration (including share of last
+      factorization) may grow over best seen before timeToRefactorize
+      says yes (default 1.1).  Maximum pivots (hard limit) and pivot
+      tolerance (Markowitz threshold) are set as before */
+  inline void setRefactorIncrease(double value)
+  {
+    refactorIncrease_ = value;
+  }
+  inline double refactorIncrease() const
+  {
+    return refactorIncrease_;
+  }
   /// Get switch to osl if number rows <= this
   inline int goOslThreshold() const
   {
@@ -535,6 +583,14 @@ private:
   int goSmallThreshold_;
   /// Switch to dense if number rows <= this
   int goDenseThreshold_;
+  /// Backend asked for (-1 not set, 4 automatic)
+  int backend_;
+  /// Number of rows when automatic backend last chosen
+  int autoRows_;
+  /// Update scheme 0 Forrest-Tomlin, 1 product form
+  int updateScheme_;
+  /// Allowed growth of average cost per iteration before refactorization
+  double refactorIncrease_;
 #endif
 #ifdef CLP_FACTORIZATION_NEW_TIMING
   /// For guessing when to re-factorize
@@ -0,0 +1,1154 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdio>
+
+#include "CoinPragma.hpp"
+#include "CoinIndexedVector.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedVector.hpp"
+
+#include "ClpSimplex.hpp"
+#include "ClpFactorization.hpp"
+// at end to get min/max!
+#include "ClpGainNetworkMatrix.hpp"
+#include "ClpPackedMatrix.hpp"
+#include "ClpMessage.hpp"
+#include <iostream>
+#include <cassert>
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpGainNetworkMatrix::ClpGainNetworkMatrix()
+  : ClpMatrixBase()
+{
+  setType(10);
+  matrix_ = NULL;
+  lengths_ = NULL;
+  indices_ = NULL;
+  gains_ = NULL;
+  numberRows_ = 0;
+  numberColumns_ = 0;
+  trueNetwork_ = false;
+}
+
+/* Constructor from three arrays */
+ClpGainNetworkMatrix::ClpGainNetworkMatrix(int numberColumns, const int *head,
+  const int *tail, const double *gain)
+  : ClpMatrixBase()
+{
+  setType(10);
+  matrix_ = NULL;
+  lengths_ = NULL;
+  indices_ = new int[2 * numberColumns];
+  gains_ = new double[numberColumns];
+  numberRows_ = -1;
+  numberColumns_ = numberColumns;
+  trueNetwork_ = true;
+  int iColumn;
+  CoinBigIndex j = 0;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+    int iRow = tail[iColumn];
+    numberRows_ = CoinMax(numberRows_, iRow);
+    indices_[j] = iRow;
+    if (iRow < 0)
+      trueNetwork_ = false;
+    iRow = head[iColumn];
+    numberRows_ = CoinMax(numberRows_, iRow);
+    indices_[j + 1] = iRow;
+    if (iRow < 0)
+      trueNetwork_ = false;
+    gains_[iColumn] = gain ? gain[iColumn] : 1.0;
+  }
+  numberRows_++;
+}
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+ClpGainNetworkMatrix::ClpGainNetworkMatrix(const ClpGainNetworkMatrix &rhs)
+  : ClpMatrixBase(rhs)
+{
+  matrix_ = NULL;
+  lengths_ = NULL;
+  indices_ = NULL;
+  gains_ = NULL;
+  numberRows_ = rhs.numberRows_;
+  numberColumns_ = rhs.numberColumns_;
+  trueNetwork_ = rhs.trueNetwork_;
+  if (numberColumns_ && rhs.indices_) {
+    indices_ = CoinCopyOfArray(rhs.indices_, 2 * numberColumns_);
+    gains_ = CoinCopyOfArray(rhs.gains_, numberColumns_);
+  }
+  int numberRows = getNumRows();
+  if (rhs.rhsOffset_ && numberRows) {
+    rhsOffset_ = ClpCopyOfArray(rhs.rhsOffset_, numberRows);
+  } else {
+    rhsOffset_ = NULL;
+  }
+}
+
+ClpGainNetworkMatrix::ClpGainNetworkMatrix(const CoinPackedMatrix &rhs)
+  : ClpMatrixBase()
+{
+  setType(10);
+  matrix_ = NULL;
+  lengths_ = NULL;
+  int iColumn;
+  assert(rhs.isColOrdered());
+  // get matrix data pointers
+  const int *row = rhs.getIndices();
+  const CoinBigIndex *columnStart = rhs.getVectorStarts();
+  const int *columnLength = rhs.getVectorLengths();
+  const double *elementByColumn = rhs.getElements();
+  numberColumns_ = rhs.getNumCols();
+  numberRows_ = rhs.getNumRows();
+  bool goodNetwork = true;
+  trueNetwork_ = true;
+  indices_ = new int[2 * numberColumns_];
+  gains_ = new double[numberColumns_];
+  CoinBigIndex j = 0;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+    CoinBigIndex k = columnStart[iColumn];
+    indices_[j] = -1;
+    indices_[j + 1] = -1;
+    gains_[iColumn] = 1.0;
+    switch (columnLength[iColumn]) {
+    case 0:
+      trueNetwork_ = false;
+      break;
+
+    case 1:
+      trueNetwork_ = false;
+      if (elementByColumn[k] == -1.0) {
+        indices_[j] = row[k];
+      } else {
+        indices_[j + 1] = row[k];
+        gains_[iColumn] = elementByColumn[k];
+      }
+      break;
+
+    case 2:
+      if (elementByColumn[k] == -1.0) {
+        indices_[j] = row[k];
+        indices_[j + 1] = row[k + 1];
+        gains_[iColumn] = elementByColumn[k + 1];
+      } else if (elementByColumn[k + 1] == -1.0) {
+        indices_[j] = row[k + 1];
+        indices_[j + 1] = row[k];
+        gains_[iColumn] = elementByColumn[k];
+      } else {
+        goodNetwork = false; // no -1.0
+      }
+      break;
+
+    default:
+      goodNetwork = false; // not a network
+      break;
+    }
+    if (!goodNetwork)
+      break;
+  }
+  if (!goodNetwork) {
+    delete[] indices_;
+    delete[] gains_;
+    // caller can test if indices_ null
+    COIN_DETAIL_PRINT(printf("Not a generalized network - can test if indices_ null\n"));
+    indices_ = NULL;
+    gains_ = NULL;
+    numberRows_ = 0;
+    numberColumns_ = 0;
+    trueNetwork_ = false;
+  }
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpGainNetworkMatrix::~ClpGainNetworkMatrix()
+{
+  delete matrix_;
+  delete[] lengths_;
+  delete[] indices_;
+  delete[] gains_;
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+ClpGainNetworkMatrix &
+ClpGainNetworkMatrix::operator=(const ClpGainNetworkMatrix &rhs)
+{
+  if (this != &rhs) {
+    ClpMatrixBase::operator=(rhs);
+    delete matrix_;
+    delete[] lengths_;
+    delete[] indices_;
+    delete[] gains_;
+    matrix_ = NULL;
+    lengths_ = NULL;
+    indices_ = NULL;
+    gains_ = NULL;
+    numberRows_ = rhs.numberRows_;
+    numberColumns_ = rhs.numberColumns_;
+    trueNetwork_ = rhs.trueNetwork_;
+    if (numberColumns_ && rhs.indices_) {
+      indices_ = CoinCopyOfArray(rhs.indices_, 2 * numberColumns_);
+      gains_ = CoinCopyOfArray(rhs.gains_, numberColumns_);
+    }
+  }
+  return *this;
+}
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+ClpMatrixBase *ClpGainNetworkMatrix::clone() const
+{
+  return new ClpGainNetworkMatrix(*this);
+}
+
+/* Returns a new matrix in reverse order without gaps */
+ClpMatrixBase *
+ClpGainNetworkMatrix::reverseOrderedCopy() const
+{
+  // count number in each row
+  CoinBigIndex *rowStart = new CoinBigIndex[numberRows_ + 1];
+  memset(rowStart, 0, (numberRows_ + 1) * sizeof(CoinBigIndex));
+  CoinBigIndex j = 0;
+  int i;
+  for (i = 0; i < 2 * numberColumns_; i++) {
+    int iRow = indices_[i];
+    if (iRow >= 0)
+      rowStart[iRow]++;
+  }
+  // do starts (from end so can put in backwards)
+  CoinBigIndex numberElements = 0;
+  for (i = 0; i < numberRows_; i++) {
+    numberElements += rowStart[i];
+    rowStart[i] = numberElements;
+  }
+  rowStart[numberRows_] = numberElements;
+  int *column = new int[numberElements];
+  double *element = new double[numberElements];
+  for (i = numberColumns_ - 1, j = 2 * i; i >= 0; i--, j -= 2) {
+    int iRow = indices_[j + 1];
+    if (iRow >= 0) {
+      CoinBigIndex put = --rowStart[iRow];
+      column[put] = i;
+      element[put] = gains_[i];
+    }
+    iRow = indices_[j];
+    if (iRow >= 0) {
+      CoinBigIndex put = --rowStart[iRow];
+      column[put] = i;
+      element[put] = -1.0;
+    }
+  }
+  CoinPackedMatrix rowMatrix(false, numberColumns_, numberRows_, numberElements,
+    element, column, rowStart, NULL);
+  delete[] rowStart;
+  delete[] column;
+  delete[] element;
+  return new ClpPackedMatrix(rowMatrix);
+}
+// Number of entries in the packed matrix
+CoinBigIndex
+ClpGainNetworkMatrix::getNumElements() const
+{
+  if (trueNetwork_)
+    return 2 * numberColumns_;
+  CoinBigIndex numberElements = 0;
+  for (int i = 0; i < 2 * numberColumns_; i++) {
+    if (indices_[i] >= 0)
+      numberElements++;
+  }
+  return numberElements;
+}
+//unscaled versions
+void ClpGainNetworkMatrix::times(double scalar,
+  const double *x, double *y) const
+{
+  int iColumn;
+  CoinBigIndex j = 0;
+  if (trueNetwork_) {
+    for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+      double value = scalar * x[iColumn];
+      if (value) {
+        int iRowM = indices_[j];
+        int iRowP = indices_[j + 1];
+        y[iRowM] -= value;
+        y[iRowP] += value * gains_[iColumn];
+      }
+    }
+  } else {
+    // skip negative rows
+    for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+      double value = scalar * x[iColumn];
+      if (value) {
+        int iRowM = indices_[j];
+        int iRowP = indices_[j + 1];
+        if (iRowM >= 0)
+          y[iRowM] -= value;
+        if (iRowP >= 0)
+          y[iRowP] += value * gains_[iColumn];
+      }
+    }
+  }
+}
+void ClpGainNetworkMatrix::transposeTimes(double scalar,
+  const double *x, double *y) const
+{
+  int iColumn;
+  CoinBigIndex j = 0;
+  if (trueNetwork_) {
+    for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+      double value = y[iColumn];
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      value -= scalar * x[iRowM];
+      value += scalar * gains_[iColumn] * x[iRowP];
+      y[iColumn] = value;
+    }
+  } else {
+    // skip negative rows
+    for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+      double value = y[iColumn];
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      if (iRowM >= 0)
+        value -= scalar * x[iRowM];
+      if (iRowP >= 0)
+        value += scalar * gains_[iColumn] * x[iRowP];
+      y[iColumn] = value;
+    }
+  }
+}
+void ClpGainNetworkMatrix::times(double scalar,
+  const double *x, double *y,
+  const double * /*rowScale*/,
+  const double * /*columnScale*/) const
+{
+  // we know it is not scaled
+  times(scalar, x, y);
+}
+void ClpGainNetworkMatrix::transposeTimes(double scalar,
+  const double *x, double *y,
+  const double * /*rowScale*/,
+  const double * /*columnScale*/,
+  double * /*spare*/) const
+{
+  // we know it is not scaled
+  transposeTimes(scalar, x, y);
+}
+/* Return <code>x * A + y</code> in <code>z</code>.
+	Squashes small elements and knows about ClpSimplex */
+void ClpGainNetworkMatrix::transposeTimes(const ClpSimplex *model, double scalar,
+  const CoinIndexedVector *rowArray,
+  CoinIndexedVector *y,
+  CoinIndexedVector *columnArray) const
+{
+  // we know it is not scaled
+  columnArray->clear();
+  double *pi = rowArray->denseVector();
+  int numberNonZero = 0;
+  int *index = columnArray->getIndices();
+  double *array = columnArray->denseVector();
+  int numberInRowArray = rowArray->getNumElements();
+  // maybe I need one in OsiSimplex
+  double zeroTolerance = model->zeroTolerance();
+  int numberRows = model->numberRows();
+#ifndef NO_RTTI
+  ClpPackedMatrix *rowCopy = dynamic_cast< ClpPackedMatrix * >(model->rowCopy());
+#else
+  ClpPackedMatrix *rowCopy = static_cast< ClpPackedMatrix * >(model->rowCopy());
+#endif
+  bool packed = rowArray->packedMode();
+  double factor = 0.3;
+  // We may not want to do by row if there may be cache problems
+  int numberColumns = model->numberColumns();
+  // It would be nice to find L2 cache size - for moment 512K
+  // Be slightly optimistic
+  if (numberColumns * sizeof(double) > 1000000) {
+    if (numberRows * 10 < numberColumns)
+      factor = 0.1;
+    else if (numberRows * 4 < numberColumns)
+      factor = 0.15;
+    else if (numberRows * 2 < numberColumns)
+      factor = 0.2;
+  }
+  if (numberInRowArray > factor * numberRows || !rowCopy) {
+    // do by column
+    int iColumn;
+    assert(!y->getNumElements());
+    CoinBigIndex j = 0;
+    if (packed) {
+      // need to expand pi into y
+      assert(y->capacity() >= numberRows);
+      double *piOld = pi;
+      pi = y->denseVector();
+      const int *whichRow = rowArray->getIndices();
+      int i;
+      // modify pi so can collapse to one loop
+      for (i = 0; i < numberInRowArray; i++) {
+        int iRow = whichRow[i];
+        pi[iRow] = scalar * piOld[i];
+      }
+      if (trueNetwork_) {
+        for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+          int iRowM = indices_[j];
+          int iRowP = indices_[j + 1];
+          double value = gains_[iColumn] * pi[iRowP] - pi[iRowM];
+          if (fabs(value) > zeroTolerance) {
+            array[numberNonZero] = value;
+            index[numberNonZero++] = iColumn;
+          }
+        }
+      } else {
+        // skip negative rows
+        for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+          double value = 0.0;
+          int iRowM = indices_[j];
+          int iRowP = indices_[j + 1];
+          if (iRowM >= 0)
+            value -= pi[iRowM];
+          if (iRowP >= 0)
+            value += gains_[iColumn] * pi[iRowP];
+          if (fabs(value) > zeroTolerance) {
+            array[numberNonZero] = value;
+            index[numberNonZero++] = iColumn;
+          }
+        }
+      }
+      for (i = 0; i < numberInRowArray; i++) {
+        int iRow = whichRow[i];
+        pi[iRow] = 0.0;
+      }
+    } else {
+      if (trueNetwork_) {
+        for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+          int iRowM = indices_[j];
+          int iRowP = indices_[j + 1];
+          double value = scalar * (gains_[iColumn] * pi[iRowP] - pi[iRowM]);
+          if (fabs(value) > zeroTolerance) {
+            index[numberNonZero++] = iColumn;
+            array[iColumn] = value;
+          }
+        }
+      } else {
+        // skip negative rows
+        for (iColumn = 0; iColumn < numberColumns_; iColumn++, j += 2) {
+          double value = 0.0;
+          int iRowM = indices_[j];
+          int iRowP = indices_[j + 1];
+          if (iRowM >= 0)
+            value -= scalar * pi[iRowM];
+          if (iRowP >= 0)
+            value += scalar * gains_[iColumn] * pi[iRowP];
+          if (fabs(value) > zeroTolerance) {
+            index[numberNonZero++] = iColumn;
+            array[iColumn] = value;
+          }
+        }
+      }
+    }
+    columnArray->setNumElements(numberNonZero);
+  } else {
+    // do by row
+    rowCopy->transposeTimesByRow(model, scalar, rowArray, y, columnArray);
+  }
+}
+/* Return <code>x *A in <code>z</code> but
+   just for indices in y. */
+void ClpGainNetworkMatrix::subsetTransposeTimes(const ClpSimplex * /*model*/,
+  const CoinIndexedVector *rowArray,
+  const CoinIndexedVector *y,
+  CoinIndexedVector *columnArray) const
+{
+  columnArray->clear();
+  double *pi = rowArray->denseVector();
+  double *array = columnArray->denseVector();
+  int jColumn;
+  int numberToDo = y->getNumElements();
+  const int *which = y->getIndices();
+  assert(!rowArray->packedMode());
+  columnArray->setPacked();
+  if (trueNetwork_) {
+    for (jColumn = 0; jColumn < numberToDo; jColumn++) {
+      int iColumn = which[jColumn];
+      CoinBigIndex j = iColumn << 1;
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      array[jColumn] = gains_[iColumn] * pi[iRowP] - pi[iRowM];
+    }
+  } else {
+    // skip negative rows
+    for (jColumn = 0; jColumn < numberToDo; jColumn++) {
+      int iColumn = which[jColumn];
+      double value = 0.0;
+      CoinBigIndex j = iColumn << 1;
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      if (iRowM >= 0)
+        value -= pi[iRowM];
+      if (iRowP >= 0)
+        value += gains_[iColumn] * pi[iRowP];
+      array[jColumn] = value;
+    }
+  }
+}
+/// returns number of elements in column part of basis,
+int ClpGainNetworkMatrix::countBasis(const int *whichColumn,
+  int &numberColumnBasic)
+{
+  int i;
+  CoinBigIndex numberElements = 0;
+  if (trueNetwork_) {
+    numberElements = 2 * numberColumnBasic;
+  } else {
+    for (i = 0; i < numberColumnBasic; i++) {
+      int iColumn = whichColumn[i];
+      CoinBigIndex j = iColumn << 1;
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      if (iRowM >= 0)
+        numberElements++;
+      if (iRowP >= 0)
+        numberElements++;
+    }
+  }
+  if (numberElements > COIN_INT_MAX) {
+    printf("Factorization too large\n");
+    abort();
+  }
+  return static_cast< int >(numberElements);
+}
+void ClpGainNetworkMatrix::fillBasis(ClpSimplex * /*model*/,
+  const int *whichColumn,
+  int &numberColumnBasic,
+  int *indexRowU, int *start,
+  int *rowCount, int *columnCount,
+  CoinFactorizationDouble *elementU)
+{
+  int i;
+  CoinBigIndex numberElements = start[0];
+  for (i = 0; i < numberColumnBasic; i++) {
+    int iColumn = whichColumn[i];
+    CoinBigIndex j = iColumn << 1;
+    int iRowM = indices_[j];
+    int iRowP = indices_[j + 1];
+    if (iRowM >= 0) {
+      indexRowU[numberElements] = iRowM;
+      rowCount[iRowM]++;
+      elementU[numberElements++] = -1.0;
+    }
+    if (iRowP >= 0 && gains_[iColumn]) {
+      indexRowU[numberElements] = iRowP;
+      rowCount[iRowP]++;
+      elementU[numberElements++] = gains_[iColumn];
+    }
+    start[i + 1] = static_cast< int >(numberElements);
+    columnCount[i] = static_cast< int >(numberElements) - start[i];
+  }
+  if (numberElements > COIN_INT_MAX) {
+    printf("Factorization too large\n");
+    abort();
+  }
+}
+/* Unpacks a column into an CoinIndexedvector
+ */
+void ClpGainNetworkMatrix::unpack(const ClpSimplex * /*model*/, CoinIndexedVector *rowArray,
+  int iColumn) const
+{
+  CoinBigIndex j = iColumn << 1;
+  int iRowM = indices_[j];
+  int iRowP = indices_[j + 1];
+  if (iRowM >= 0)
+    rowArray->add(iRowM, -1.0);
+  if (iRowP >= 0)
+    rowArray->add(iRowP, gains_[iColumn]);
+}
+/* Unpacks a column into an CoinIndexedvector
+** in packed foramt
+Note that model is NOT const.  Bounds and objective could
+be modified if doing column generation (just for this variable) */
+void ClpGainNetworkMatrix::unpackPacked(ClpSimplex * /*model*/,
+  CoinIndexedVector *rowArray,
+  int iColumn) const
+{
+  int *index = rowArray->getIndices();
+  double *array = rowArray->denseVector();
+  int number = 0;
+  CoinBigIndex j = iColumn << 1;
+  int iRowM = indices_[j];
+  int iRowP = indices_[j + 1];
+  if (iRowM >= 0) {
+    array[number] = -1.0;
+    index[number++] = iRowM;
+  }
+  if (iRowP >= 0 && gains_[iColumn]) {
+    array[number] = gains_[iColumn];
+    index[number++] = iRowP;
+  }
+  rowArray->setNumElements(number);
+  rowArray->setPackedMode(true);
+}
+/* Adds multiple of a column into an CoinIndexedvector
+      You can use quickAdd to add to vector */
+void ClpGainNetworkMatrix::add(const ClpSimplex * /*model*/, CoinIndexedVector *rowArray,
+  int iColumn, double multiplier) const
+{
+  CoinBigIndex j = iColumn << 1;
+  int iRowM = indices_[j];
+  int iRowP = indices_[j + 1];
+  if (iRowM >= 0)
+    rowArray->quickAdd(iRowM, -multiplier);
+  if (iRowP >= 0)
+    rowArray->quickAdd(iRowP, multiplier * gains_[iColumn]);
+}
+/* Adds multiple of a column into an array */
+void ClpGainNetworkMatrix::add(const ClpSimplex * /*model*/, double *array,
+  int iColumn, double multiplier) const
+{
+  CoinBigIndex j = iColumn << 1;
+  int iRowM = indices_[j];
+  int iRowP = indices_[j + 1];
+  if (iRowM >= 0)
+    array[iRowM] -= multiplier;
+  if (iRowP >= 0)
+    array[iRowP] += multiplier * gains_[iColumn];
+}
+
+// Return a complete CoinPackedMatrix
+CoinPackedMatrix *
+ClpGainNetworkMatrix::getPackedMatrix() const
+{
+  if (!matrix_) {
+    // pairs with any gap at end of pair
+    CoinBigIndex numberElements = 2 * numberColumns_;
+    double *elements = new double[numberElements];
+    int *indices = new int[numberElements];
+    CoinBigIndex *starts = new CoinBigIndex[numberColumns_ + 1];
+    delete[] lengths_;
+    lengths_ = new int[numberColumns_];
+    CoinBigIndex j = 0;
+    for (int i = 0; i < numberColumns_; i++, j += 2) {
+      starts[i] = j;
+      CoinBigIndex put = j;
+      if (indices_[j] >= 0) {
+        elements[put] = -1.0;
+        indices[put++] = indices_[j];
+      }
+      if (indices_[j + 1] >= 0) {
+        elements[put] = gains_[i];
+        indices[put++] = indices_[j + 1];
+      }
+      lengths_[i] = static_cast< int >(put - j);
+      for (; put < j + 2; put++) {
+        elements[put] = 0.0;
+        indices[put] = 0;
+      }
+    }
+    starts[numberColumns_] = numberElements;
+    // use assignMatrix to save space
+    int *lengths = CoinCopyOfArray(lengths_, numberColumns_);
+    matrix_ = new CoinPackedMatrix();
+    matrix_->assignMatrix(true, numberRows_, numberColumns_,
+      getNumElements(),
+      elements, indices,
+      starts, lengths);
+    assert(!elements);
+    assert(!starts);
+    assert(!indices);
+    assert(!lengths);
+  }
+  return matrix_;
+}
+/* A vector containing the elements in the packed matrix. Note that there
+   might be gaps in this list, entries that do not belong to any
+   major-dimension vector. To get the actual elements one should look at
+   this vector together with vectorStarts and vectorLengths. */
+const double *
+ClpGainNetworkMatrix::getElements() const
+{
+  if (!matrix_)
+    getPackedMatrix();
+  return matrix_->getElements();
+}
+/* A vector containing the minor indices (NULL if not
+   a valid generalized network) */
+const int *
+ClpGainNetworkMatrix::getIndices() const
+{
+  if (!indices_ || trueNetwork_)
+    return indices_;
+  if (!matrix_)
+    getPackedMatrix();
+  return matrix_->getIndices();
+}
+
+const CoinBigIndex *
+ClpGainNetworkMatrix::getVectorStarts() const
+{
+  if (!matrix_)
+    getPackedMatrix();
+  return matrix_->getVectorStarts();
+}
+/* The lengths of the major-dimension vectors. */
+const int *
+ClpGainNetworkMatrix::getVectorLengths() const
+{
+  if (!lengths_) {
+    lengths_ = new int[numberColumns_];
+    CoinBigIndex j = 0;
+    for (int i = 0; i < numberColumns_; i++, j += 2) {
+      int n = 0;
+      if (indices_[j] >= 0)
+        n++;
+      if (indices_[j + 1] >= 0)
+        n++;
+      lengths_[i] = n;
+    }
+  }
+  return lengths_;
+}
+/* Delete the columns whose indices are listed in <code>indDel</code>. */
+void ClpGainNetworkMatrix::deleteCols(const int numDel, const int *indDel)
+{
+  int iColumn;
+  int numberBad = 0;
+  // Use array to make sure we can have duplicates
+  char *which = new char[numberColumns_];
+  memset(which, 0, numberColumns_);
+  int nDuplicate = 0;
+  for (iColumn = 0; iColumn < numDel; iColumn++) {
+    int jColumn = indDel[iColumn];
+    if (jColumn < 0 || jColumn >= numberColumns_) {
+      numberBad++;
+    } else {
+      if (which[jColumn])
+        nDuplicate++;
+      else
+        which[jColumn] = 1;
+    }
+  }
+  if (numberBad) {
+    delete[] which;
+    throw CoinError("Indices out of range", "deleteCols", "ClpGainNetworkMatrix");
+  }
+  int newNumber = numberColumns_ - numDel + nDuplicate;
+  // Get rid of temporary arrays
+  releasePackedMatrix();
+  int *newIndices = new int[2 * newNumber];
+  double *newGains = new double[newNumber];
+  int n = 0;
+  trueNetwork_ = true;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (!which[iColumn]) {
+      newIndices[2 * n] = indices_[2 * iColumn];
+      newIndices[2 * n + 1] = indices_[2 * iColumn + 1];
+      if (newIndices[2 * n] < 0 || newIndices[2 * n + 1] < 0)
+        trueNetwork_ = false;
+      newGains[n++] = gains_[iColumn];
+    }
+  }
+  delete[] which;
+  delete[] indices_;
+  delete[] gains_;
+  indices_ = newIndices;
+  gains_ = newGains;
+  numberColumns_ = newNumber;
+}
+/* Delete the rows whose indices are listed in <code>indDel</code>. */
+void ClpGainNetworkMatrix::deleteRows(const int numDel, const int *indDel)
+{
+  int iRow;
+  int numberBad = 0;
+  // Use array to make sure we can have duplicates
+  int *which = new int[numberRows_];
+  memset(which, 0, numberRows_ * sizeof(int));
+  for (iRow = 0; iRow < numDel; iRow++) {
+    int jRow = indDel[iRow];
+    if (jRow < 0 || jRow >= numberRows_) {
+      numberBad++;
+    } else {
+      which[jRow] = 1;
+    }
+  }
+  if (numberBad) {
+    delete[] which;
+    throw CoinError("Indices out of range", "deleteRows", "ClpGainNetworkMatrix");
+  }
+  // Only valid of all columns have 0 entries
+  int i;
+  for (i = 0; i < 2 * numberColumns_; i++) {
+    int iRow = indices_[i];
+    if (iRow >= 0 && which[iRow])
+      numberBad++;
+  }
+  if (numberBad) {
+    delete[] which;
+    throw CoinError("Row has entries", "deleteRows", "ClpGainNetworkMatrix");
+  }
+  int newNumber = 0;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    if (!which[iRow])
+      which[iRow] = newNumber++;
+    else
+      which[iRow] = -1;
+  }
+  for (i = 0; i < 2 * numberColumns_; i++) {
+    int iRow = indices_[i];
+    if (iRow >= 0)
+      indices_[i] = which[iRow];
+  }
+  delete[] which;
+  releasePackedMatrix();
+  numberRows_ = newNumber;
+}
+/* Given positive integer weights for each row fills in sum of weights
+   for each column (and slack).
+   Returns weights vector
+*/
+CoinBigIndex *
+ClpGainNetworkMatrix::dubiousWeights(const ClpSimplex *model, int *inputWeights) const
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  int number = numberRows + numberColumns;
+  CoinBigIndex *weights = new CoinBigIndex[number];
+  int i;
+  for (i = 0; i < numberColumns; i++) {
+    CoinBigIndex j = i << 1;
+    CoinBigIndex count = 0;
+    int iRowM = indices_[j];
+    int iRowP = indices_[j + 1];
+    if (iRowM >= 0) {
+      count += inputWeights[iRowM];
+    }
+    if (iRowP >= 0) {
+      count += inputWeights[iRowP];
+    }
+    weights[i] = count;
+  }
+  for (i = 0; i < numberRows; i++) {
+    weights[i + numberColumns] = inputWeights[i];
+  }
+  return weights;
+}
+/* Returns largest and smallest elements of both signs.
+   Largest refers to largest absolute value.
+*/
+void ClpGainNetworkMatrix::rangeOfElements(double &smallestNegative, double &largestNegative,
+  double &smallestPositive, double &largestPositive)
+{
+  smallestNegative = -COIN_DBL_MAX;
+  largestNegative = 0.0;
+  smallestPositive = COIN_DBL_MAX;
+  largestPositive = 0.0;
+  CoinBigIndex j = 0;
+  for (int i = 0; i < numberColumns_; i++, j += 2) {
+    if (indices_[j] >= 0) {
+      smallestNegative = CoinMax(smallestNegative, -1.0);
+      largestNegative = CoinMin(largestNegative, -1.0);
+    }
+    double value = gains_[i];
+    if (indices_[j + 1] >= 0 && value) {
+      if (value > 0.0) {
+        smallestPositive = CoinMin(smallestPositive, value);
+        largestPositive = CoinMax(largestPositive, value);
+      } else {
+        smallestNegative = CoinMax(smallestNegative, value);
+        largestNegative = CoinMin(largestNegative, value);
+      }
+    }
+  }
+  if (smallestNegative == -COIN_DBL_MAX)
+    smallestNegative = 0.0;
+  if (smallestPositive == COIN_DBL_MAX)
+    smallestPositive = 0.0;
+}
+// Says whether it can do partial pricing
+bool ClpGainNetworkMatrix::canDoPartialPricing() const
+{
+  return true;
+}
+// Partial pricing
+void ClpGainNetworkMatrix::partialPricing(ClpSimplex *model, double startFraction, double endFraction,
+  int &bestSequence, int &numberWanted)
+{
+  numberWanted = currentWanted_;
+  int j;
+  int start = static_cast< int >(startFraction * numberColumns_);
+  int end = CoinMin(static_cast< int >(endFraction * numberColumns_ + 1), numberColumns_);
+  double tolerance = model->currentDualTolerance();
+  double *reducedCost = model->djRegion();
+  const double *duals = model->dualRowSolution();
+  const double *cost = model->costRegion();
+  double bestDj;
+  if (bestSequence >= 0)
+    bestDj = fabs(reducedCost[bestSequence]);
+  else
+    bestDj = tolerance;
+  int sequenceOut = model->sequenceOut();
+  int saveSequence = bestSequence;
+  int iSequence;
+  for (iSequence = start; iSequence < end; iSequence++) {
+    if (iSequence != sequenceOut) {
+      double value;
+      ClpSimplex::Status status = model->getStatus(iSequence);
+      if (status == ClpSimplex::basic || status == ClpSimplex::isFixed)
+        continue;
+      value = cost[iSequence];
+      j = iSequence << 1;
+      // skip negative rows
+      int iRowM = indices_[j];
+      int iRowP = indices_[j + 1];
+      if (iRowM >= 0)
+        value += duals[iRowM];
+      if (iRowP >= 0)
+        value -= gains_[iSequence] * duals[iRowP];
+      switch (status) {
+
+      case ClpSimplex::basic:
+      case ClpSimplex::isFixed:
+        break;
+      case ClpSimplex::isFree:
+      case ClpSimplex::superBasic:
+        value = fabs(value);
+        if (value > FREE_ACCEPT * tolerance) {
+          numberWanted--;
+          // we are going to bias towards free (but only if reasonable)
+          value *= FREE_BIAS;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      case ClpSimplex::atUpperBound:
+        if (value > tolerance) {
+          numberWanted--;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      case ClpSimplex::atLowerBound:
+        value = -value;
+        if (value > tolerance) {
+          numberWanted--;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      }
+    }
+    if (!numberWanted)
+      break;
+  }
+  if (bestSequence != saveSequence) {
+    // recompute dj
+    double value = cost[bestSequence];
+    j = bestSequence << 1;
+    // skip negative rows
+    int iRowM = indices_[j];
+    int iRowP = indices_[j + 1];
+    if (iRowM >= 0)
+      value += duals[iRowM];
+    if (iRowP >= 0)
+      value -= gains_[bestSequence] * duals[iRowP];
+    reducedCost[bestSequence] = value;
+    savedBestSequence_ = bestSequence;
+    savedBestDj_ = reducedCost[savedBestSequence_];
+  }
+  currentWanted_ = numberWanted;
+}
+// Allow any parts of a created CoinMatrix to be deleted
+void ClpGainNetworkMatrix::releasePackedMatrix() const
+{
+  delete matrix_;
+  delete[] lengths_;
+  matrix_ = NULL;
+  lengths_ = NULL;
+}
+// Append Columns
+void ClpGainNetworkMatrix::appendCols(int number, const CoinPackedVectorBase *const *columns)
+{
+  int iColumn;
+  int numberBad = 0;
+  for (iColumn = 0; iColumn < number; iColumn++) {
+    int n = columns[iColumn]->getNumElements();
+    const double *element = columns[iColumn]->getElements();
+    if (n > 2)
+      numberBad++;
+    else if (n == 2 && element[0] != -1.0 && element[1] != -1.0)
+      numberBad++;
+  }
+  if (numberBad)
+    throw CoinError("Not generalized network", "appendCols", "ClpGainNetworkMatrix");
+  // Get rid of temporary arrays
+  releasePackedMatrix();
+  int *temp2 = new int[2 * (numberColumns_ + number)];
+  CoinMemcpyN(indices_, 2 * numberColumns_, temp2);
+  delete[] indices_;
+  indices_ = temp2;
+  double *temp = new double[numberColumns_ + number];
+  CoinMemcpyN(gains_, numberColumns_, temp);
+  delete[] gains_;
+  gains_ = temp;
+  // now add
+  CoinBigIndex size = 2 * numberColumns_;
+  for (iColumn = 0; iColumn < number; iColumn++) {
+    int n = columns[iColumn]->getNumElements();
+    const int *row = columns[iColumn]->getIndices();
+    const double *element = columns[iColumn]->getElements();
+    int jColumn = numberColumns_ + iColumn;
+    gains_[jColumn] = 1.0;
+    if (n == 2) {
+      int k = (element[0] == -1.0) ? 0 : 1;
+      indices_[size++] = row[k];
+      indices_[size++] = row[1 - k];
+      gains_[jColumn] = element[1 - k];
+    } else {
+      trueNetwork_ = false;
+      if (!n) {
+        indices_[size++] = -1;
+        indices_[size++] = -1;
+      } else if (element[0] == -1.0) {
+        indices_[size++] = row[0];
+        indices_[size++] = -1;
+      } else {
+        indices_[size++] = -1;
+        indices_[size++] = row[0];
+        gains_[jColumn] = element[0];
+      }
+    }
+  }
+
+  numberColumns_ += number;
+}
+// Append Rows
+void ClpGainNetworkMatrix::appendRows(int number, const CoinPackedVectorBase *const *rows)
+{
+  // must be zero arrays
+  int numberBad = 0;
+  int iRow;
+  for (iRow = 0; iRow < number; iRow++) {
+    numberBad += rows[iRow]->getNumElements();
+  }
+  if (numberBad)
+    throw CoinError("Not NULL rows", "appendRows", "ClpGainNetworkMatrix");
+  releasePackedMatrix();
+  numberRows_ += number;
+}
+#ifndef SLIM_CLP
+/* Append a set of rows/columns to the end of the matrix. Returns number of errors
+   i.e. if any of the new rows/columns contain an index that's larger than the
+   number of columns-1/rows-1 (if numberOther>0) or duplicates
+   If 0 then rows, 1 if columns */
+int ClpGainNetworkMatrix::appendMatrix(int number, int type,
+  const CoinBigIndex *starts, const int *index,
+  const double *element, int /*numberOther*/)
+{
+  int numberErrors = 0;
+  // make into CoinPackedVector
+  CoinPackedVectorBase **vectors = new CoinPackedVectorBase *[number];
+  int iVector;
+  for (iVector = 0; iVector < number; iVector++) {
+    CoinBigIndex iStart = starts[iVector];
+    vectors[iVector] = new CoinPackedVector(static_cast< int >(starts[iVector + 1] - iStart),
+      index + iStart, element + iStart);
+  }
+  if (type == 0) {
+    // rows
+    appendRows(number, vectors);
+  } else {
+    // columns
+    appendCols(number, vectors);
+  }
+  for (iVector = 0; iVector < number; iVector++)
+    delete vectors[iVector];
+  delete[] vectors;
+  return numberErrors;
+}
+#endif
+/* Subset clone (without gaps).  Duplicates are allowed
+   and order is as given */
+ClpMatrixBase *
+ClpGainNetworkMatrix::subsetClone(int numberRows, const int *whichRows,
+  int numberColumns,
+  const int *whichColumns) const
+{
+  return new ClpGainNetworkMatrix(*this, numberRows, whichRows,
+    numberColumns, whichColumns);
+}
+/* Subset constructor (without gaps).  Duplicates are allowed
+   and order is as given */
+ClpGainNetworkMatrix::ClpGainNetworkMatrix(
+  const ClpGainNetworkMatrix &rhs,
+  int numberRows, const int *whichRow,
+  int numberColumns, const int *whichColumn)
+  : ClpMatrixBase(rhs)
+{
+  setType(10);
+  matrix_ = NULL;
+  lengths_ = NULL;
+  indices_ = new int[2 * numberColumns];
+  gains_ = new double[numberColumns];
+  numberRows_ = numberRows;
+  numberColumns_ = numberColumns;
+  trueNetwork_ = true;
+  int iColumn;
+  int *which = new int[rhs.numberRows_];
+  int iRow;
+  for (iRow = 0; iRow < rhs.numberRows_; iRow++)
+    which[iRow] = -1;
+  int n = 0;
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    int jRow = whichRow[iRow];
+    assert(jRow >= 0 && jRow < rhs.numberRows_);
+    which[jRow] = n++;
+  }
+  // rows not in subset are dropped (so may become slack like)
+  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int jColumn = whichColumn[iColumn];
+    for (int k = 0; k < 2; k++) {
+      int iRow = rhs.indices_[2 * jColumn + k];
+      if (iRow >= 0)
+        iRow = which[iRow];
+      indices_[2 * iColumn + k] = iRow;
+      if (iRow < 0)
+        trueNetwork_ = false;
+    }
+    gains_[iColumn] = rhs.gains_[jColumn];
+  }
+  delete[] which;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -7,6 +7,10 @@
 #include "CoinPragma.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 
 #include "ClpSimplex.hpp"
 #include "ClpFactorization.hpp"
@@ -1330,6 +1334,187 @@ void ClpGubMatrix::add(const ClpSimplex *model, double *array,
   }
 }
 // Partial pricing
+#if ABOCA_LITE
+/* Gub pricing for a chunk of columns.
+   Set dual (djMod) is computed once each time a new set is met, sets
+   are contiguous so this is once per set.  Scaling is optional (lower
+   is rowScale, upper is columnScale).
+   On entry numberRemaining is number wanted and bestPossible is
+   best so far, on exit numberAdded is best sequence (numberColumns+set
+   for gub slack) and changeObj its djMod.
+   As in serial code gives up when more than numberInfeasibilities sets
+   scanned and numberRemaining is down to acceptablePivot (on exit
+   numberInfeasibilities is -1 if gave up) and flagged candidates do
+   not count as found */
+static void
+gubPriceBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT element = info.element;
+  const int *COIN_RESTRICT row = info.row;
+  const CoinBigIndex *COIN_RESTRICT startColumn = info.start;
+  const int *COIN_RESTRICT length = info.which;
+  const double *COIN_RESTRICT duals = info.work;
+  const double *COIN_RESTRICT cost = info.cost;
+  const double *COIN_RESTRICT rowScale = info.lower;
+  const double *COIN_RESTRICT columnScale = info.upper;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const unsigned char *COIN_RESTRICT setStatus = reinterpret_cast< const unsigned char * >(info.spare);
+  const int *COIN_RESTRICT backward = info.pivotVariable;
+  const int *COIN_RESTRICT keyVariable = info.index;
+  int numberColumns = info.numberColumns;
+  int sequenceOut = info.numberAdded;
+  double tolerance = info.dualTolerance;
+  double infeasibilityCost = info.theta;
+  double bestDj = info.bestPossible;
+  int numberWanted = info.numberRemaining;
+  int minSet = info.numberInfeasibilities;
+  int giveUpWanted = static_cast< int >(info.acceptablePivot);
+  int nSets = 0;
+  int bestSequence = -1;
+  double bestDjMod = 0.0;
+  double djMod = 0.0;
+  int iSet = -1;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  info.numberInfeasibilities = 0;
+  for (int iSequence = first; iSequence < last; iSequence++) {
+    if (numberWanted <= giveUpWanted && nSets > minSet) {
+      // give up
+      info.numberInfeasibilities = -1;
+      break;
+    }
+    if (backward[iSequence] != iSet) {
+      iSet = backward[iSequence];
+      djMod = 0.0;
+      if (iSet >= 0) {
+        nSets++;
+        int iBasic = keyVariable[iSet];
+        if (iBasic >= numberColumns) {
+          int iStat = (setStatus[iSet] & 31) >> 3;
+          djMod = -static_cast< double >(iStat - 1) * infeasibilityCost;
+        } else {
+          // get dj without
+          if (!rowScale) {
+            for (CoinBigIndex j = startColumn[iBasic];
+                 j < startColumn[iBasic] + length[iBasic]; j++)
+              djMod -= duals[row[j]] * element[j];
+            djMod += cost[iBasic];
+          } else {
+            for (CoinBigIndex j = startColumn[iBasic];
+                 j < startColumn[iBasic] + length[iBasic]; j++) {
+              int jRow = row[j];
+              djMod -= duals[jRow] * element[j] * rowScale[jRow];
+            }
+            djMod += cost[iBasic] / columnScale[iBasic];
+          }
+          // See if gub slack possible - dj is djMod
+          double value = 0.0;
+          if ((setStatus[iSet] & 7) == ClpSimplex::atLowerBound)
+            value = -djMod;
+          else if ((setStatus[iSet] & 7) == ClpSimplex::atUpperBound)
+            value = djMod;
+          if (value > tolerance) {
+            numberWanted--;
+            if (value > bestDj) {
+              if ((setStatus[iSet] & 64) == 0) {
+                bestDj = value;
+                bestSequence = numberColumns + iSet;
+                bestDjMod = djMod;
+              } else {
+                // flagged - make sure we don't exit before got something
+                numberWanted++;
+              }
+            }
+          }
+        }
+      }
+    }
+    if (iSequence == sequenceOut)
+      continue;
+    int iStatus = status[iSequence] & 7;
+    if (iStatus == ClpSimplex::basic || iStatus == ClpSimplex::isFixed)
+      continue;
+    double value = 0.0;
+    if (!rowScale) {
+      for (CoinBigIndex j = startColumn[iSequence];
+           j < startColumn[iSequence] + length[iSequence]; j++)
+        value += duals[row[j]] * element[j];
+      value = cost[iSequence] - djMod - value;
+    } else {
+      for (CoinBigIndex j = startColumn[iSequence];
+           j < startColumn[iSequence] + length[iSequence]; j++) {
+        int jRow = row[j];
+        value += duals[jRow] * element[j] * rowScale[jRow];
+      }
+      value = cost[iSequence] - (djMod + value) * columnScale[iSequence];
+    }
+    if (iStatus == ClpSimplex::atLowerBound) {
+      value = -value;
+    } else if (iStatus != ClpSimplex::atUpperBound) {
+      // free or superbasic
+      value = fabs(value);
+      if (value > FREE_ACCEPT * tolerance)
+        value *= FREE_BIAS;
+      else
+        value = 0.0;
+    }
+    if (value > tolerance) {
+      numberWanted--;
+      if (value > bestDj) {
+        if ((status[iSequence] & 64) == 0) {
+          bestDj = value;
+          bestSequence = iSequence;
+          bestDjMod = djMod;
+        } else {
+          // flagged - make sure we don't exit before got something
+          numberWanted++;
+        }
+      }
+    }
+    if (numberWanted <= 0)
+      break;
+  }
+  info.numberAdded = bestSequence;
+  info.bestPossible = bestDj;
+  info.changeObj = bestDjMod;
+  info.numberRemaining = numberWanted;
+}
+/* Takes dual on set out of djs of basic variables in a range of sets
+   (startColumn and numberToDo are sets) */
+static void
+gubKeyDualBit(clpTempInfo &info)
+{
+  double *COIN_RESTRICT dj = info.solution;
+  const int *COIN_RESTRICT keyVariable = info.pivotVariable;
+  const int *COIN_RESTRICT next = info.which;
+  const unsigned char *COIN_RESTRICT setStatus = reinterpret_cast< const unsigned char * >(info.spare);
+  double infeasibilityCost = info.theta;
+  int numberColumns = info.numberColumns;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int iSet = first; iSet < last; iSet++) {
+    int kColumn = keyVariable[iSet];
+    double value;
+    if (kColumn < numberColumns) {
+      // dj without set
+      value = dj[kColumn];
+      dj[kColumn] = 0.0;
+    } else {
+      // slack key - may not be feasible
+      int iStat = (setStatus[iSet] & 31) >> 3;
+      value = -static_cast< double >(iStat - 1) * infeasibilityCost;
+    }
+    if (value) {
+      int iColumn = next[kColumn];
+      // modify all non-key variables basic
+      while (iColumn >= 0) {
+        dj[iColumn] -= value;
+        iColumn = next[iColumn];
+      }
+    }
+  }
+}
+#endif
 void ClpGubMatrix::partialPricing(ClpSimplex *model, double startFraction, double endFraction,
   int &bestSequence, int &numberWanted)
 {
@@ -1376,7 +1561,117 @@ void ClpGubMatrix::partialPricing(ClpSimplex *model, double startFraction, doubl
       int iSet = -1;
       double djMod = 0.0;
       double infeasibilityCost = model->infeasibilityCost();
-      if (rowScale) {
+#if ABOCA_LITE
+      int numberThreads = abcState();
+      if (numberThreads > 1 && endAll - startG > 10000 * numberThreads) {
+        /* many sets - price chunks in parallel each with share of wanted.
+           Rules are as serial code - only go past endG if nothing found,
+           give up after enough sets if enough found */
+        clpTempInfo info[ABOCA_LITE];
+        int iBest = -1;
+        double bestDjMod = 0.0;
+        for (int iPass = 0; iPass < 2; iPass++) {
+          int start = startG;
+          int end = endG;
+          if (iPass) {
+            if (bestSequence >= 0 || iBest >= 0 || !numberWanted)
+              break;
+            start = endG;
+            end = endAll;
+          }
+          if (end <= start)
+            continue;
+          int chunk = (end - start + numberThreads - 1) / numberThreads;
+          int wanted = (numberWanted + numberThreads - 1) / numberThreads;
+          // shares of already found and of limits for giving up
+          int alreadyFound = (originalWanted_ - numberWanted + numberThreads - 1) / numberThreads;
+          int minNegChunk = (minNeg + numberThreads - 1) / numberThreads;
+          int minSetChunk = (minSet + numberThreads - 1) / numberThreads;
+          int n = start;
+          for (int i = 0; i < numberThreads; i++) {
+            info[i].element = element;
+            info[i].row = row;
+            info[i].start = startColumn;
+            info[i].which = const_cast< int * >(length);
+            info[i].work = const_cast< double * >(duals);
+            info[i].cost = cost;
+            info[i].lower = rowScale;
+            info[i].upper = columnScale;
+            info[i].status = model->statusArray();
+            info[i].spare = reinterpret_cast< double * >(status_);
+            info[i].pivotVariable = backward_;
+            info[i].index = keyVariable_;
+            info[i].numberColumns = numberColumns;
+            info[i].numberAdded = sequenceOut;
+            info[i].dualTolerance = tolerance;
+            info[i].theta = infeasibilityCost;
+            info[i].bestPossible = bestDj;
+            info[i].numberRemaining = wanted;
+            info[i].numberInfeasibilities = minSetChunk;
+            info[i].acceptablePivot = wanted + alreadyFound - minNegChunk - 1;
+            info[i].startColumn = n;
+            info[i].numberToDo = CoinMax(CoinMin(chunk, end - n), 0);
+            n += info[i].numberToDo;
+          }
+          for (int i = 0; i < numberThreads; i++)
+            cilk_spawn gubPriceBit(info[i]);
+          cilk_sync;
+          int numberFound = 0;
+          bool gaveUp = false;
+          for (int i = 0; i < numberThreads; i++) {
+            numberFound += wanted - info[i].numberRemaining;
+            if (info[i].numberInfeasibilities < 0)
+              gaveUp = true;
+            if (info[i].numberAdded >= 0 && info[i].bestPossible > bestDj) {
+              bestDj = info[i].bestPossible;
+              iBest = info[i].numberAdded;
+              bestDjMod = info[i].changeObj;
+            }
+          }
+          numberWanted = gaveUp ? 0 : CoinMax(numberWanted - numberFound, 0);
+        }
+        if (iBest >= 0) {
+          if (iBest < numberColumns) {
+            // recompute dj
+            bestSequence = iBest;
+            double value = 0.0;
+            if (!rowScale) {
+              for (j = startColumn[bestSequence];
+                   j < startColumn[bestSequence] + length[bestSequence]; j++)
+                value += duals[row[j]] * element[j];
+              value = cost[bestSequence] - bestDjMod - value;
+            } else {
+              for (j = startColumn[bestSequence];
+                   j < startColumn[bestSequence] + length[bestSequence]; j++) {
+                int jRow = row[j];
+                value += duals[jRow] * element[j] * rowScale[jRow];
+              }
+              value = cost[bestSequence] - (bestDjMod + value) * columnScale[bestSequence];
+            }
+            reducedCost[bestSequence] = value;
+            gubSlackIn_ = -1;
+          } else {
+            // slack - make last column
+            gubSlackIn_ = iBest - numberColumns;
+            bestSequence = numberColumns + 2 * numberRows;
+            reducedCost[bestSequence] = bestDjMod;
+            model->setStatus(bestSequence, getStatus(gubSlackIn_));
+            if (getStatus(gubSlackIn_) == ClpSimplex::atUpperBound)
+              model->solutionRegion()[bestSequence] = upper_[gubSlackIn_];
+            else
+              model->solutionRegion()[bestSequence] = lower_[gubSlackIn_];
+            model->lowerRegion()[bestSequence] = lower_[gubSlackIn_];
+            model->upperRegion()[bestSequence] = upper_[gubSlackIn_];
+            model->costRegion()[bestSequence] = 0.0;
+          }
+          if (rowScale) {
+            savedBestSequence_ = bestSequence;
+            savedBestDj_ = reducedCost[savedBestSequence_];
+          }
+        }
+      } else
+#endif
+        if (rowScale) {
         double bestDjMod = 0.0;
         // scaled
         for (iSequence = startG; iSequence < endAll; iSequence++) {
@@ -2228,6 +2523,30 @@ void ClpGubMatrix::dualExpanded(ClpSimplex *model,
     double *dj = model->djRegion();
     int numberColumns = model->numberColumns();
     double infeasibilityCost = model->infeasibilityCost();
+#if ABOCA_LITE
+    int numberThreads = abcState();
+    if (numberThreads > 1 && numberSets_ > 10000 * numberThreads) {
+      // sets touch disjoint djs so do in parallel
+      clpTempInfo info[ABOCA_LITE];
+      int chunk = (numberSets_ + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (i = 0; i < numberThreads; i++) {
+        info[i].solution = dj;
+        info[i].pivotVariable = keyVariable_;
+        info[i].which = next_;
+        info[i].spare = reinterpret_cast< double * >(status_);
+        info[i].theta = infeasibilityCost;
+        info[i].numberColumns = numberColumns;
+        info[i].startColumn = n;
+        info[i].numberToDo = CoinMin(chunk, numberSets_ - n);
+        n += info[i].numberToDo;
+      }
+      for (i = 0; i < numberThreads; i++)
+        cilk_spawn gubKeyDualBit(info[i]);
+      cilk_sync;
+      break;
+    }
+#endif
     for (i = 0; i < numberSets_; i++) {
       int kColumn = keyVariable_[i];
       if (kColumn < numberColumns) {
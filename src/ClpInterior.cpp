@@ -959,6 +959,14 @@ int ClpInterior::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &o
 // Primal-Dual Predictor-Corrector barrier
 int ClpInterior::primalDual()
 {
+  if (objective_->type() > 2) {
+    // only linear and quadratic objectives are allowed
+    handler_->message(CLP_GENERAL, messages_)
+      << "Barrier can not handle this nonlinear objective - use primal"
+      << CoinMessageEol;
+    problemStatus_ = 4;
+    return problemStatus_;
+  }
   return (static_cast< ClpPredictorCorrector * >(this))->solve();
 }
 
@@ -1207,25 +1215,21 @@ ClpInterior::quadraticDjs(CoinWorkDouble *djRegion, const CoinWorkDouble *soluti
     quadraticObj = (static_cast< ClpQuadraticObjective * >(objective_));
 #endif
   if (quadraticObj) {
-    CoinPackedMatrix *quadratic = quadraticObj->quadraticObjective();
-    const int *columnQuadratic = quadratic->getIndices();
-    const CoinBigIndex *columnQuadraticStart = quadratic->getVectorStarts();
-    const int *columnQuadraticLength = quadratic->getVectorLengths();
-    double *quadraticElement = quadratic->getMutableElements();
-    int numberColumns = quadratic->getNumCols();
-    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
-      CoinWorkDouble value = 0.0;
-      for (CoinBigIndex j = columnQuadraticStart[iColumn];
-           j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-        int jColumn = columnQuadratic[j];
-        CoinWorkDouble valueJ = solution[jColumn];
-        CoinWorkDouble elementValue = quadraticElement[j];
-        //value += valueI*valueJ*elementValue;
-        value += valueJ * elementValue;
-        quadraticOffset += solution[iColumn] * valueJ * elementValue;
-      }
-      djRegion[iColumn] += scaleFactor * value;
-    }
+    // saved Q*x in objective is used (full matrix or triangle)
+    int numberColumns = quadraticObj->quadraticObjective()->getNumCols();
+    double *product = new double[numberColumns];
+#if COIN_LONG_WORK
+    double *x = new double[numberColumns];
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      x[iColumn] = static_cast< double >(solution[iColumn]);
+    quadraticOffset = quadraticObj->quadraticTimes(x, product);
+    delete[] x;
+#else
+    quadraticOffset = quadraticObj->quadraticTimes(solution, product);
+#endif
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      djRegion[iColumn] += scaleFactor * product[iColumn];
+    delete[] product;
   }
   return quadraticOffset;
 }
@@ -0,0 +1,617 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinIndexedVector.hpp"
+#include "ClpFactorization.hpp"
+#include "ClpSimplex.hpp"
+#include "ClpLowRankObjective.hpp"
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpLowRankObjective::ClpLowRankObjective()
+  : ClpObjective()
+{
+  type_ = 3;
+  factors_ = NULL;
+  diagonal_ = NULL;
+  objective_ = NULL;
+  gradient_ = NULL;
+  numberColumns_ = 0;
+  numberExtendedColumns_ = 0;
+  numberFactors_ = 0;
+  activated_ = 0;
+}
+
+//-------------------------------------------------------------------
+// Useful Constructor
+//-------------------------------------------------------------------
+ClpLowRankObjective::ClpLowRankObjective(const double *objective,
+  int numberColumns,
+  int numberFactors, const double *factors,
+  const double *diagonal,
+  int numberExtendedColumns)
+  : ClpObjective()
+{
+  type_ = 3;
+  numberColumns_ = numberColumns;
+  if (numberExtendedColumns >= 0)
+    numberExtendedColumns_ = CoinMax(numberColumns_, numberExtendedColumns);
+  else
+    numberExtendedColumns_ = numberColumns_;
+  objective_ = new double[numberExtendedColumns_];
+  if (objective) {
+    CoinMemcpyN(objective, numberColumns_, objective_);
+    memset(objective_ + numberColumns_, 0, (numberExtendedColumns_ - numberColumns_) * sizeof(double));
+  } else {
+    memset(objective_, 0, numberExtendedColumns_ * sizeof(double));
+  }
+  factors_ = NULL;
+  diagonal_ = NULL;
+  numberFactors_ = 0;
+  gradient_ = NULL;
+  activated_ = 1;
+  loadFactorModel(numberFactors, factors, diagonal);
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+ClpLowRankObjective::ClpLowRankObjective(const ClpLowRankObjective &rhs)
+  : ClpObjective(rhs)
+{
+  numberColumns_ = rhs.numberColumns_;
+  numberExtendedColumns_ = rhs.numberExtendedColumns_;
+  numberFactors_ = rhs.numberFactors_;
+  objective_ = CoinCopyOfArray(rhs.objective_, numberExtendedColumns_);
+  gradient_ = CoinCopyOfArray(rhs.gradient_, numberExtendedColumns_);
+  diagonal_ = CoinCopyOfArray(rhs.diagonal_, numberColumns_);
+  factors_ = CoinCopyOfArray(rhs.factors_, numberColumns_ * numberFactors_);
+}
+/* Subset constructor.  Duplicates are allowed
+   and order is as given.
+*/
+ClpLowRankObjective::ClpLowRankObjective(const ClpLowRankObjective &rhs,
+  int numberColumns,
+  const int *whichColumn)
+  : ClpObjective(rhs)
+{
+  objective_ = NULL;
+  diagonal_ = NULL;
+  factors_ = NULL;
+  numberFactors_ = rhs.numberFactors_;
+  int extra = rhs.numberExtendedColumns_ - rhs.numberColumns_;
+  numberColumns_ = 0;
+  numberExtendedColumns_ = numberColumns + extra;
+  if (numberColumns > 0) {
+    // check valid lists
+    int numberBad = 0;
+    int i;
+    for (i = 0; i < numberColumns; i++)
+      if (whichColumn[i] < 0 || whichColumn[i] >= rhs.numberColumns_)
+        numberBad++;
+    if (numberBad)
+      throw CoinError("bad column list", "subset constructor",
+        "ClpLowRankObjective");
+    numberColumns_ = numberColumns;
+    objective_ = new double[numberExtendedColumns_];
+    for (i = 0; i < numberColumns_; i++)
+      objective_[i] = rhs.objective_[whichColumn[i]];
+    CoinMemcpyN(rhs.objective_ + rhs.numberColumns_, extra,
+      objective_ + numberColumns_);
+    if (rhs.diagonal_) {
+      diagonal_ = new double[numberColumns_];
+      for (i = 0; i < numberColumns_; i++)
+        diagonal_[i] = rhs.diagonal_[whichColumn[i]];
+    }
+    if (rhs.factors_) {
+      factors_ = new double[numberColumns_ * numberFactors_];
+      for (i = 0; i < numberColumns_; i++)
+        CoinMemcpyN(rhs.factors_ + whichColumn[i] * numberFactors_,
+          numberFactors_, factors_ + i * numberFactors_);
+    }
+  }
+  gradient_ = NULL;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpLowRankObjective::~ClpLowRankObjective()
+{
+  delete[] factors_;
+  delete[] diagonal_;
+  delete[] objective_;
+  delete[] gradient_;
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+ClpLowRankObjective &
+ClpLowRankObjective::operator=(const ClpLowRankObjective &rhs)
+{
+  if (this != &rhs) {
+    delete[] factors_;
+    delete[] diagonal_;
+    delete[] objective_;
+    delete[] gradient_;
+    ClpObjective::operator=(rhs);
+    numberColumns_ = rhs.numberColumns_;
+    numberExtendedColumns_ = rhs.numberExtendedColumns_;
+    numberFactors_ = rhs.numberFactors_;
+    objective_ = CoinCopyOfArray(rhs.objective_, numberExtendedColumns_);
+    gradient_ = CoinCopyOfArray(rhs.gradient_, numberExtendedColumns_);
+    diagonal_ = CoinCopyOfArray(rhs.diagonal_, numberColumns_);
+    factors_ = CoinCopyOfArray(rhs.factors_, numberColumns_ * numberFactors_);
+  }
+  return *this;
+}
+// Load up factor model
+void ClpLowRankObjective::loadFactorModel(int numberFactors, const double *factors,
+  const double *diagonal)
+{
+  delete[] factors_;
+  delete[] diagonal_;
+  numberFactors_ = factors ? numberFactors : 0;
+  factors_ = CoinCopyOfArray(factors, numberColumns_ * numberFactors_);
+  diagonal_ = CoinCopyOfArray(diagonal, numberColumns_);
+}
+// Sets result to F'*vector
+void ClpLowRankObjective::factorTimes(const double *vector, const double *columnScale,
+  double *result) const
+{
+  CoinZeroN(result, numberFactors_);
+  if (!factors_)
+    return;
+  const double *factor = factors_;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    double value = vector[iColumn];
+    if (value) {
+      if (columnScale)
+        value *= columnScale[iColumn];
+      for (int k = 0; k < numberFactors_; k++)
+        result[k] += factor[k] * value;
+    }
+    factor += numberFactors_;
+  }
+}
+
+// Returns gradient
+double *
+ClpLowRankObjective::gradient(const ClpSimplex *model,
+  const double *solution, double &offset, bool refresh,
+  int includeLinear)
+{
+  offset = 0.0;
+  bool scaling = false;
+  if (model && (model->rowScale() || model->objectiveScale() != 1.0 || model->optimizationDirection() != 1.0))
+    scaling = true;
+  const double *cost = NULL;
+  if (model)
+    cost = model->costRegion();
+  if (!cost) {
+    // not in solve
+    cost = objective_;
+    scaling = false;
+  }
+  if (!scaling && (!solution || !activated_ || (!factors_ && !diagonal_)))
+    return objective_;
+  assert(solution);
+  if (refresh || !gradient_) {
+    if (!gradient_)
+      gradient_ = new double[numberExtendedColumns_];
+    double direction = 1.0;
+    const double *columnScale = NULL;
+    int iColumn;
+    if (!scaling) {
+      // use current linear cost region
+      if (includeLinear == 1)
+        CoinMemcpyN(cost, numberExtendedColumns_, gradient_);
+      else if (includeLinear == 2)
+        CoinMemcpyN(objective_, numberExtendedColumns_, gradient_);
+      else
+        memset(gradient_, 0, numberExtendedColumns_ * sizeof(double));
+    } else {
+      direction = model->optimizationDirection() * model->objectiveScale();
+      columnScale = model->columnScale();
+      // use current linear cost region (already scaled)
+      if (includeLinear == 1) {
+        CoinMemcpyN(model->costRegion(), numberExtendedColumns_, gradient_);
+      } else if (includeLinear == 2) {
+        memset(gradient_ + numberColumns_, 0, (numberExtendedColumns_ - numberColumns_) * sizeof(double));
+        if (!columnScale) {
+          for (iColumn = 0; iColumn < numberColumns_; iColumn++)
+            gradient_[iColumn] = objective_[iColumn] * direction;
+        } else {
+          for (iColumn = 0; iColumn < numberColumns_; iColumn++)
+            gradient_[iColumn] = objective_[iColumn] * direction * columnScale[iColumn];
+        }
+      } else {
+        memset(gradient_, 0, numberExtendedColumns_ * sizeof(double));
+      }
+    }
+    if (activated_) {
+      // Q*x is F*(F'*x) + D*x
+      double *product = new double[numberFactors_];
+      factorTimes(solution, columnScale, product);
+      const double *factor = factors_;
+      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        double valueI = solution[iColumn];
+        double scaleI = columnScale ? columnScale[iColumn] : 1.0;
+        double value = 0.0;
+        if (factor) {
+          for (int k = 0; k < numberFactors_; k++)
+            value += factor[k] * product[k];
+          factor += numberFactors_;
+        }
+        value *= scaleI;
+        if (diagonal_)
+          value += diagonal_[iColumn] * scaleI * scaleI * valueI;
+        value *= direction;
+        offset += value * valueI;
+        gradient_[iColumn] += value;
+      }
+      offset *= 0.5;
+      delete[] product;
+    }
+  }
+  if (model) {
+    if (!scaling)
+      offset *= model->objectiveScale();
+    else
+      offset *= model->optimizationDirection();
+  }
+  return gradient_;
+}
+
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+ClpObjective *ClpLowRankObjective::clone() const
+{
+  return new ClpLowRankObjective(*this);
+}
+/* Subset clone.  Duplicates are allowed
+   and order is as given.
+*/
+ClpObjective *
+ClpLowRankObjective::subsetClone(int numberColumns,
+  const int *whichColumns) const
+{
+  return new ClpLowRankObjective(*this, numberColumns, whichColumns);
+}
+// Resize objective
+void ClpLowRankObjective::resize(int newNumberColumns)
+{
+  if (numberColumns_ != newNumberColumns) {
+    int newExtended = newNumberColumns + (numberExtendedColumns_ - numberColumns_);
+    int n = CoinMin(numberColumns_, newNumberColumns);
+    double *newArray = new double[newExtended];
+    if (objective_)
+      CoinMemcpyN(objective_, n, newArray);
+    if (newNumberColumns > numberColumns_)
+      CoinZeroN(newArray + numberColumns_, newNumberColumns - numberColumns_);
+    if (objective_)
+      CoinMemcpyN(objective_ + numberColumns_, numberExtendedColumns_ - numberColumns_,
+        newArray + newNumberColumns);
+    else
+      CoinZeroN(newArray + newNumberColumns, numberExtendedColumns_ - numberColumns_);
+    delete[] objective_;
+    objective_ = newArray;
+    delete[] gradient_;
+    gradient_ = NULL;
+    if (diagonal_) {
+      newArray = new double[newNumberColumns];
+      CoinMemcpyN(diagonal_, n, newArray);
+      if (newNumberColumns > numberColumns_)
+        CoinZeroN(newArray + numberColumns_, newNumberColumns - numberColumns_);
+      delete[] diagonal_;
+      diagonal_ = newArray;
+    }
+    if (factors_) {
+      newArray = new double[newNumberColumns * numberFactors_];
+      CoinMemcpyN(factors_, n * numberFactors_, newArray);
+      if (newNumberColumns > numberColumns_)
+        CoinZeroN(newArray + numberColumns_ * numberFactors_,
+          (newNumberColumns - numberColumns_) * numberFactors_);
+      delete[] factors_;
+      factors_ = newArray;
+    }
+    numberColumns_ = newNumberColumns;
+    numberExtendedColumns_ = newExtended;
+  }
+}
+// Delete columns in  objective
+void ClpLowRankObjective::deleteSome(int numberToDelete, const int *which)
+{
+  int newNumberColumns = numberColumns_;
+  if (objective_) {
+    int i;
+    char *deleted = new char[numberColumns_];
+    int numberDeleted = 0;
+    memset(deleted, 0, numberColumns_ * sizeof(char));
+    for (i = 0; i < numberToDelete; i++) {
+      int j = which[i];
+      if (j >= 0 && j < numberColumns_ && !deleted[j]) {
+        numberDeleted++;
+        deleted[j] = 1;
+      }
+    }
+    newNumberColumns = numberColumns_ - numberDeleted;
+    int put = 0;
+    for (i = 0; i < numberColumns_; i++) {
+      if (!deleted[i]) {
+        objective_[put] = objective_[i];
+        if (diagonal_)
+          diagonal_[put] = diagonal_[i];
+        if (factors_ && put < i)
+          CoinMemcpyN(factors_ + i * numberFactors_, numberFactors_,
+            factors_ + put * numberFactors_);
+        put++;
+      }
+    }
+    // extended part
+    for (i = numberColumns_; i < numberExtendedColumns_; i++)
+      objective_[put++] = objective_[i];
+    delete[] deleted;
+    delete[] gradient_;
+    gradient_ = NULL;
+    numberExtendedColumns_ -= numberColumns_ - newNumberColumns;
+    numberColumns_ = newNumberColumns;
+  }
+}
+/* Returns reduced gradient.Returns an offset (to be added to current one).
+ */
+double
+ClpLowRankObjective::reducedGradient(ClpSimplex *model, double *region,
+  bool useFeasibleCosts)
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+
+  //work space
+  CoinIndexedVector *workSpace = model->rowArray(0);
+
+  CoinIndexedVector arrayVector;
+  arrayVector.reserve(numberRows + 1);
+
+  int iRow;
+#ifdef CLP_DEBUG
+  workSpace->checkClear();
+#endif
+  double *array = arrayVector.denseVector();
+  int *index = arrayVector.getIndices();
+  int number = 0;
+  const double *costNow = gradient(model, model->solutionRegion(), offset_,
+    true, useFeasibleCosts ? 2 : 1);
+  double *cost = model->costRegion();
+  const int *pivotVariable = model->pivotVariable();
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    int iPivot = pivotVariable[iRow];
+    double value;
+    if (iPivot < numberColumns)
+      value = costNow[iPivot];
+    else if (!useFeasibleCosts)
+      value = cost[iPivot];
+    else
+      value = 0.0;
+    if (value) {
+      array[iRow] = value;
+      index[number++] = iRow;
+    }
+  }
+  arrayVector.setNumElements(number);
+
+  // Btran basic costs
+  model->factorization()->updateColumnTranspose(workSpace, &arrayVector);
+  double *work = workSpace->denseVector();
+  ClpFillN(work, numberRows, 0.0);
+  // now look at dual solution
+  double *rowReducedCost = region + numberColumns;
+  double *dual = rowReducedCost;
+  const double *rowCost = cost + numberColumns;
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    dual[iRow] = array[iRow];
+  }
+  double *dj = region;
+  ClpDisjointCopyN(costNow, numberColumns, dj);
+
+  model->transposeTimes(-1.0, dual, dj);
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    // slack
+    double value = dual[iRow];
+    value += rowCost[iRow];
+    rowReducedCost[iRow] = value;
+  }
+  return offset_;
+}
+/* Returns step length which gives minimum of objective for
+   solution + theta * change vector up to maximum theta.
+
+   arrays are numberColumns+numberRows
+*/
+double
+ClpLowRankObjective::stepLength(ClpSimplex *model,
+  const double *solution,
+  const double *change,
+  double maximumTheta,
+  double &currentObj,
+  double &predictedObj,
+  double &thetaObj)
+{
+  const double *cost = model->costRegion();
+  bool inSolve = true;
+  if (!cost) {
+    // not in solve
+    cost = objective_;
+    inSolve = false;
+  }
+  double delta = 0.0;
+  double linearCost = 0.0;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  int numberTotal = numberColumns;
+  if (inSolve)
+    numberTotal += numberRows;
+  currentObj = 0.0;
+  thetaObj = 0.0;
+  for (int iColumn = 0; iColumn < numberTotal; iColumn++) {
+    delta += cost[iColumn] * change[iColumn];
+    linearCost += cost[iColumn] * solution[iColumn];
+  }
+  if (!activated_ || (!factors_ && !diagonal_)) {
+    currentObj = linearCost;
+    thetaObj = currentObj + delta * maximumTheta;
+    if (delta < 0.0) {
+      return maximumTheta;
+    } else {
+      COIN_DETAIL_PRINT(printf("odd linear direction %g\n", delta));
+      return 0.0;
+    }
+  }
+  double direction = 1.0;
+  const double *columnScale = NULL;
+  if ((model->rowScale() || model->objectiveScale() != 1.0 || model->optimizationDirection() != 1.0) && inSolve) {
+    columnScale = model->columnScale();
+    direction = model->optimizationDirection() * model->objectiveScale();
+    // direction is actually scale out not scale in
+    if (direction)
+      direction = 1.0 / direction;
+  }
+  // with y=F'x and z=F'change - x'Qx is y'y+x'Dx etc
+  double *product = new double[2 * numberFactors_];
+  double *productChange = product + numberFactors_;
+  factorTimes(solution, columnScale, product);
+  factorTimes(change, columnScale, productChange);
+  double a = 0.0;
+  double b = 0.0;
+  double c = 0.0;
+  for (int k = 0; k < numberFactors_; k++) {
+    a += productChange[k] * productChange[k];
+    b += productChange[k] * product[k];
+    c += product[k] * product[k];
+  }
+  delete[] product;
+  if (diagonal_) {
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      double valueI = solution[iColumn];
+      double changeI = change[iColumn];
+      double elementValue = diagonal_[iColumn];
+      if (columnScale)
+        elementValue *= columnScale[iColumn] * columnScale[iColumn];
+      a += changeI * changeI * elementValue;
+      b += changeI * valueI * elementValue;
+      c += valueI * valueI * elementValue;
+    }
+  }
+  a *= 0.5 * direction;
+  b = b * direction + delta;
+  c *= 0.5 * direction;
+  double theta;
+  currentObj = c + linearCost;
+  thetaObj = currentObj + a * maximumTheta * maximumTheta + b * maximumTheta;
+  // minimize a*x*x + b*x + c
+  if (a <= 0.0) {
+    theta = maximumTheta;
+  } else {
+    theta = -0.5 * b / a;
+  }
+  predictedObj = currentObj + a * theta * theta + b * theta;
+  return CoinMin(theta, maximumTheta);
+}
+// Return objective value (without any ClpModel offset) (model may be NULL)
+double
+ClpLowRankObjective::objectiveValue(const ClpSimplex *model, const double *solution) const
+{
+  bool scaling = false;
+  if (model && (model->rowScale() || model->objectiveScale() != 1.0))
+    scaling = true;
+  const double *cost = NULL;
+  if (model)
+    cost = model->costRegion();
+  if (!cost) {
+    // not in solve
+    cost = objective_;
+    scaling = false;
+  }
+  double linearCost = 0.0;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    linearCost += cost[iColumn] * solution[iColumn];
+  }
+  if (!activated_ || (!factors_ && !diagonal_))
+    return linearCost;
+  double direction = 1.0;
+  const double *columnScale = NULL;
+  if (scaling) {
+    columnScale = model->columnScale();
+    direction = model->objectiveScale();
+    // direction is actually scale out not scale in
+    if (direction)
+      direction = 1.0 / direction;
+  }
+  double *product = new double[numberFactors_];
+  factorTimes(solution, columnScale, product);
+  double c = 0.0;
+  for (int k = 0; k < numberFactors_; k++)
+    c += product[k] * product[k];
+  delete[] product;
+  if (diagonal_) {
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      double valueI = solution[iColumn];
+      double elementValue = diagonal_[iColumn];
+      if (columnScale)
+        elementValue *= columnScale[iColumn] * columnScale[iColumn];
+      c += valueI * valueI * elementValue;
+    }
+  }
+  return 0.5 * direction * c + linearCost;
+}
+// Scale objective
+void ClpLowRankObjective::reallyScale(const double *columnScale)
+{
+  double *factor = factors_;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    double scaleI = columnScale[iColumn];
+    objective_[iColumn] *= scaleI;
+    if (diagonal_)
+      diagonal_[iColumn] *= scaleI * scaleI;
+    if (factor) {
+      for (int k = 0; k < numberFactors_; k++)
+        factor[k] *= scaleI;
+      factor += numberFactors_;
+    }
+  }
+}
+/* Given a zeroed array sets nonlinear columns to 1.
+   Returns number of nonlinear columns
+*/
+int ClpLowRankObjective::markNonlinear(char *which)
+{
+  int numberNonLinearColumns = 0;
+  const double *factor = factors_;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    bool nonLinear = diagonal_ && diagonal_[iColumn];
+    if (factor) {
+      for (int k = 0; k < numberFactors_; k++) {
+        if (factor[k])
+          nonLinear = true;
+      }
+      factor += numberFactors_;
+    }
+    if (nonLinear) {
+      which[iColumn] = 1;
+      numberNonLinearColumns++;
+    } else if (which[iColumn]) {
+      numberNonLinearColumns++;
+    }
+  }
+  return numberNonLinearColumns;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,172 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpLowRankObjective_H
+#define ClpLowRankObjective_H
+
+#include "ClpObjective.hpp"
+
+//#############################################################################
+
+/** Low rank plus diagonal (factor model) Quadratic Objective Class
+
+    Objective is c'x + 0.5 x'Qx where Q = F*F' + D is never formed.
+    F is numberColumns by numberFactors (stored by column of problem so
+    factor k of column i is factors[i*numberFactors+k]) and D is diagonal.
+    Gradient, step length and objective value are all O(n*k).
+*/
+
+class CLPLIB_EXPORT ClpLowRankObjective : public ClpObjective {
+
+public:
+  ///@name Stuff
+  //@{
+
+  /** Returns gradient.  If Quadratic then solution may be NULL,
+         also returns an offset (to be added to current one)
+         If refresh is false then uses last solution
+         Uses model for scaling
+         includeLinear 0 - no, 1 as is, 2 as feasible
+     */
+  virtual double *gradient(const ClpSimplex *model,
+    const double *solution, double &offset, bool refresh,
+    int includeLinear = 2);
+  /** Returns reduced gradient.Returns an offset (to be added to current one).
+     */
+  virtual double reducedGradient(ClpSimplex *model, double *region,
+    bool useFeasibleCosts);
+  /** Returns step length which gives minimum of objective for
+         solution + theta * change vector up to maximum theta.
+
+         arrays are numberColumns+numberRows
+         Also sets current objective, predicted and at maximumTheta
+     */
+  virtual double stepLength(ClpSimplex *model,
+    const double *solution,
+    const double *change,
+    double maximumTheta,
+    double &currentObj,
+    double &predictedObj,
+    double &thetaObj);
+  /// Return objective value (without any ClpModel offset) (model may be NULL)
+  virtual double objectiveValue(const ClpSimplex *model, const double *solution) const;
+  /// Resize objective
+  virtual void resize(int newNumberColumns);
+  /// Delete columns in  objective
+  virtual void deleteSome(int numberToDelete, const int *which);
+  /// Scale objective
+  virtual void reallyScale(const double *columnScale);
+  /** Given a zeroed array sets nonlinear columns to 1.
+         Returns number of nonlinear columns
+      */
+  virtual int markNonlinear(char *which);
+
+  //@}
+
+  ///@name Constructors and destructors
+  //@{
+  /// Default Constructor
+  ClpLowRankObjective();
+
+  /** Constructor from objective.
+         factors is numberColumns*numberFactors (by column),
+         diagonal may be NULL (all zero)
+     */
+  ClpLowRankObjective(const double *linearObjective, int numberColumns,
+    int numberFactors, const double *factors,
+    const double *diagonal,
+    int numberExtendedColumns = -1);
+
+  /// Copy constructor
+  ClpLowRankObjective(const ClpLowRankObjective &rhs);
+  /** Subset constructor.  Duplicates are allowed
+         and order is as given.
+     */
+  ClpLowRankObjective(const ClpLowRankObjective &rhs, int numberColumns,
+    const int *whichColumns);
+
+  /// Assignment operator
+  ClpLowRankObjective &operator=(const ClpLowRankObjective &rhs);
+
+  /// Destructor
+  virtual ~ClpLowRankObjective();
+
+  /// Clone
+  virtual ClpObjective *clone() const;
+  /** Subset clone.  Duplicates are allowed
+         and order is as given.
+     */
+  virtual ClpObjective *subsetClone(int numberColumns,
+    const int *whichColumns) const;
+
+  /** Load up factor model.  factors is numberColumns*numberFactors
+         (by column), diagonal may be NULL */
+  void loadFactorModel(int numberFactors, const double *factors,
+    const double *diagonal);
+  //@}
+  ///@name Gets and sets
+  //@{
+  /// Factors (numberColumns*numberFactors)
+  inline double *factors() const
+  {
+    return factors_;
+  }
+  /// Diagonal
+  inline double *diagonal() const
+  {
+    return diagonal_;
+  }
+  /// Linear objective
+  inline double *linearObjective() const
+  {
+    return objective_;
+  }
+  /// Number of factors
+  inline int numberFactors() const
+  {
+    return numberFactors_;
+  }
+  /// Length of linear objective which could be bigger
+  inline int numberExtendedColumns() const
+  {
+    return numberExtendedColumns_;
+  }
+  /// Number of columns in objective
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  //@}
+
+  //---------------------------------------------------------------------------
+
+private:
+  ///@name Private functions
+  //@{
+  /** Sets result (numberFactors) to F'*vector (F scaled by
+         columnScale if not NULL) */
+  void factorTimes(const double *vector, const double *columnScale,
+    double *result) const;
+  //@}
+  ///@name Private member data
+  /// Factors (numberColumns_*numberFactors_)
+  double *factors_;
+  /// Diagonal
+  double *diagonal_;
+  /// Objective
+  double *objective_;
+  /// Gradient
+  double *gradient_;
+  /// Useful to have number of columns about
+  int numberColumns_;
+  /// Also length of linear objective which could be bigger
+  int numberExtendedColumns_;
+  /// Number of factors
+  int numberFactors_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -673,15 +673,8 @@ void ClpNonLinearCost::checkInfeasibilities(double oldTolerance)
         thisFeasibleCost = cost_[end - 2];
         cost_[end - 1] = thisFeasibleCost + infeasibilityCost;
       }
-      for (iRange = start; iRange < end; iRange++) {
-        if (value < lower_[iRange + 1] + primalTolerance) {
-          // put in better range if infeasible
-          if (value >= lower_[iRange + 1] - primalTolerance && infeasible(iRange) && iRange == start)
-            iRange++;
-          whichRange_[iSequence] = iRange;
-          break;
-        }
-      }
+      iRange = findRange(iSequence, value, primalTolerance);
+      whichRange_[iSequence] = iRange;
       assert(iRange < end);
       lowerValue = lower_[iRange];
       upperValue = lower_[iRange + 1];
@@ -1335,6 +1328,15 @@ void ClpNonLinearCost::goBackAll(const CoinIndexedVector *update)
     }
   }
 }
+/* Where value is - CLP_BELOW_LOWER, CLP_FEASIBLE or CLP_ABOVE_UPPER.
+   Written without branches as called for every updated basic */
+static inline int whereIs(double value, double lowerValue,
+  double upperValue, double primalTolerance)
+{
+  int above = (value - upperValue > primalTolerance) ? 1 : 0;
+  int below = (value - lowerValue < -primalTolerance) ? 1 : 0;
+  return CLP_FEASIBLE + above - (below & (above ^ 1));
+}
 void ClpNonLinearCost::checkInfeasibilities(int numberInArray, const int *index)
 {
   assert(model_ != NULL);
@@ -1345,20 +1347,10 @@ void ClpNonLinearCost::checkInfeasibilities(int numberInArray, const int *index)
       int iRow = index[i];
       int iSequence = pivotVariable[iRow];
       // get where in bound sequence
-      int iRange;
       int currentRange = whichRange_[iSequence];
       double value = model_->solution(iSequence);
-      int start = start_[iSequence];
-      int end = start_[iSequence + 1] - 1;
-      for (iRange = start; iRange < end; iRange++) {
-        if (value < lower_[iRange + 1] + primalTolerance) {
-          // put in better range
-          if (value >= lower_[iRange + 1] - primalTolerance && infeasible(iRange) && iRange == start)
-            iRange++;
-          break;
-        }
-      }
-      assert(iRange < end);
+      int iRange = findRange(iSequence, value, primalTolerance);
+      assert(iRange < start_[iSequence + 1] - 1);
       assert(model_->getStatus(iSequence) == ClpSimplex::basic);
       double &lower = model_->lowerAddress(iSequence);
       double &upper = model_->upperAddress(iSequence);
@@ -1400,25 +1392,12 @@ void ClpNonLinearCost::checkInfeasibilities(int numberInArray, const int *index)
         lowerValue = bound_[iSequence];
         numberInfeasibilities_--;
       }
-      // get correct place
-      int newWhere = CLP_FEASIBLE;
-      if (value - upperValue <= primalTolerance) {
-        if (value - lowerValue >= -primalTolerance) {
-          // feasible
-          //newWhere=CLP_FEASIBLE;
-        } else {
-          // below
-          newWhere = CLP_BELOW_LOWER;
-          assert(fabs(lowerValue) < 1.0e100);
-          costValue -= infeasibilityWeight_;
-          numberInfeasibilities_++;
-        }
-      } else {
-        // above
-        newWhere = CLP_ABOVE_UPPER;
-        costValue += infeasibilityWeight_;
-        numberInfeasibilities_++;
-      }
+      // get correct place (without branches)
+      int newWhere = whereIs(value, lowerValue, upperValue, primalTolerance);
+      int direction = newWhere - CLP_FEASIBLE;
+      assert(newWhere != CLP_BELOW_LOWER || fabs(lowerValue) < 1.0e100);
+      costValue += direction * infeasibilityWeight_;
+      numberInfeasibilities_ += direction & 1;
       if (iWhere != newWhere) {
         setOriginalStatus(status_[iSequence], newWhere);
         if (newWhere == CLP_BELOW_LOWER) {
@@ -1456,19 +1435,9 @@ void ClpNonLinearCost::checkChanged(int numberInArray, CoinIndexedVector *update
       int iRow = index[i];
       int iSequence = pivotVariable[iRow];
       // get where in bound sequence
-      int iRange;
       double value = model_->solution(iSequence);
-      int start = start_[iSequence];
-      int end = start_[iSequence + 1] - 1;
-      for (iRange = start; iRange < end; iRange++) {
-        if (value < lower_[iRange + 1] + primalTolerance) {
-          // put in better range
-          if (value >= lower_[iRange + 1] - primalTolerance && infeasible(iRange) && iRange == start)
-            iRange++;
-          break;
-        }
-      }
-      assert(iRange < end);
+      int iRange = findRange(iSequence, value, primalTolerance);
+      assert(iRange < start_[iSequence + 1] - 1);
       assert(model_->getStatus(iSequence) == ClpSimplex::basic);
       int jRange = whichRange_[iSequence];
       if (iRange != jRange) {
@@ -1514,25 +1483,12 @@ void ClpNonLinearCost::checkChanged(int numberInArray, CoinIndexedVector *update
         lowerValue = bound_[iSequence];
         numberInfeasibilities_--;
       }
-      // get correct place
-      int newWhere = CLP_FEASIBLE;
-      if (value - upperValue <= primalTolerance) {
-        if (value - lowerValue >= -primalTolerance) {
-          // feasible
-          //newWhere=CLP_FEASIBLE;
-        } else {
-          // below
-          newWhere = CLP_BELOW_LOWER;
-          costValue -= infeasibilityWeight_;
-          numberInfeasibilities_++;
-          assert(fabs(lowerValue) < 1.0e100);
-        }
-      } else {
-        // above
-        newWhere = CLP_ABOVE_UPPER;
-        costValue += infeasibilityWeight_;
-        numberInfeasibilities_++;
-      }
+      // get correct place (without branches)
+      int newWhere = whereIs(value, lowerValue, upperValue, primalTolerance);
+      int direction = newWhere - CLP_FEASIBLE;
+      assert(newWhere != CLP_BELOW_LOWER || fabs(lowerValue) < 1.0e100);
+      costValue += direction * infeasibilityWeight_;
+      numberInfeasibilities_ += direction & 1;
       if (iWhere != newWhere) {
         work[iRow] = cost[iSequence] - costValue;
         index[number++] = iRow;
@@ -368,6 +368,30 @@ public:
   {
     return status_;
   }
+  /** Range value lies in - first range whose upper end is above value
+      (moving off infeasible bottom range if just at its top).
+      No loop for usual case of at most three ranges */
+  inline int findRange(int sequence, double value, double primalTolerance) const
+  {
+    int start = start_[sequence];
+    int end = start_[sequence + 1] - 1;
+    int iRange;
+    int numberRanges = end - start;
+    if (numberRanges <= 3) {
+      const double *breakPoint = lower_ + start;
+      iRange = start + ((numberRanges > 1 && value >= breakPoint[1] + primalTolerance) ? 1 : 0);
+      iRange += (numberRanges > 2 && value >= breakPoint[2] + primalTolerance) ? 1 : 0;
+    } else {
+      for (iRange = start; iRange < end; iRange++) {
+        if (value < lower_[iRange + 1] + primalTolerance)
+          break;
+      }
+    }
+    // put in better range if infeasible
+    if (iRange == start && infeasible(start) && value >= lower_[start + 1] - primalTolerance)
+      iRange++;
+    return iRange;
+  }
   /// For debug
   void validate();
   //@}
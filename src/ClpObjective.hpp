@@ -128,7 +128,7 @@ protected:
   //@{
   /// Value of non-linear part of objective
   double offset_;
-  /// Type of objective - linear is 1
+  /// Type of objective - linear is 1, quadratic 2, low rank 3
   int type_;
   /// Whether activated
   int activated_;
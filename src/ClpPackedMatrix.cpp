@@ -69,6 +69,17 @@ static void debug3(int iColumn, double &thisWeight, double pivotSquared, double
   thisWeight = oldWeight;
   thisWeight += pivotSquared * devex + pivot * modification;
 }
+// Scale cache is key (sizes, hash, smallest and largest) then scales
+#define CLP_SCALE_CACHE_KEY 6
+static double *copyScaleCache(const double *cache)
+{
+  if (cache) {
+    int n = CLP_SCALE_CACHE_KEY + static_cast< int >(cache[0]) + static_cast< int >(cache[1]);
+    return CoinCopyOfArray(cache, n);
+  } else {
+    return NULL;
+  }
+}
 //-------------------------------------------------------------------
 // Default Constructor
 //-------------------------------------------------------------------
@@ -79,6 +90,7 @@ ClpPackedMatrix::ClpPackedMatrix()
   , flags_(2)
   , rowCopy_(NULL)
   , columnCopy_(NULL)
+  , scaleCache_(NULL)
 {
   setType(1);
 }
@@ -122,6 +134,7 @@ ClpPackedMatrix::ClpPackedMatrix(const ClpPackedMatrix &rhs)
   } else {
     columnCopy_ = NULL;
   }
+  scaleCache_ = copyScaleCache(rhs.scaleCache_);
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
 #endif
@@ -137,6 +150,7 @@ ClpPackedMatrix::ClpPackedMatrix(CoinPackedMatrix *rhs)
   numberActiveColumns_ = matrix_->getNumCols();
   rowCopy_ = NULL;
   columnCopy_ = NULL;
+  scaleCache_ = NULL;
   setType(1);
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
@@ -156,6 +170,7 @@ ClpPackedMatrix::ClpPackedMatrix(const CoinPackedMatrix &rhs)
   numberActiveColumns_ = matrix_->getNumCols();
   rowCopy_ = NULL;
   columnCopy_ = NULL;
+  scaleCache_ = NULL;
   setType(1);
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
@@ -170,6 +185,7 @@ ClpPackedMatrix::~ClpPackedMatrix()
   delete matrix_;
   delete rowCopy_;
   delete columnCopy_;
+  delete[] scaleCache_;
 }
 
 //----------------------------------------------------------------
@@ -205,6 +221,8 @@ ClpPackedMatrix::operator=(const ClpPackedMatrix &rhs)
     } else {
       columnCopy_ = NULL;
     }
+    delete[] scaleCache_;
+    scaleCache_ = copyScaleCache(rhs.scaleCache_);
 #ifdef DO_CHECK_FLAGS
     checkFlags(0);
 #endif
@@ -253,6 +271,7 @@ ClpPackedMatrix::ClpPackedMatrix(
   rowCopy_ = NULL;
   flags_ = rhs.flags_ & (~0x02); // no gaps
   columnCopy_ = NULL;
+  scaleCache_ = NULL;
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
 #endif
@@ -269,6 +288,7 @@ ClpPackedMatrix::ClpPackedMatrix(
   rowCopy_ = NULL;
   flags_ = 0; // no gaps
   columnCopy_ = NULL;
+  scaleCache_ = NULL;
   setType(1);
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
@@ -4120,6 +4140,151 @@ ClpPackedMatrix::scale2(ClpModel * model) const
 }
 #endif
 //#define SQRT_ARRAY
+// Adds value to pair of hashes used as key for scale cache
+static inline void scaleHash(unsigned int *hash, double value)
+{
+  unsigned int bits[2];
+  memcpy(bits, &value, sizeof(double));
+  hash[0] = (hash[0] ^ bits[0]) * 16777619U;
+  hash[0] = (hash[0] ^ bits[1]) * 16777619U;
+  hash[1] = (hash[1] + bits[0]) * 2654435761U;
+  hash[1] = (hash[1] + bits[1]) * 2246822519U;
+}
+/* Key for scale cache - covers everything scale factors depend on
+   (matrix, which columns useful, bounds and options) */
+static void scaleCacheKey(const ClpModel *model, const CoinPackedMatrix *matrix,
+  const char *usefulColumn, unsigned int *hash)
+{
+  int numberRows = model->numberRows();
+  int numberColumns = matrix->getNumCols();
+  const int *COIN_RESTRICT row = matrix->getIndices();
+  const CoinBigIndex *COIN_RESTRICT columnStart = matrix->getVectorStarts();
+  const int *COIN_RESTRICT columnLength = matrix->getVectorLengths();
+  const double *COIN_RESTRICT elementByColumn = matrix->getElements();
+  const double *COIN_RESTRICT rowLower = model->rowLower();
+  const double *COIN_RESTRICT rowUpper = model->rowUpper();
+  const double *COIN_RESTRICT columnLower = model->columnLower();
+  const double *COIN_RESTRICT columnUpper = model->columnUpper();
+  hash[0] = 2166136261U;
+  hash[1] = 0;
+  scaleHash(hash, model->scalingFlag());
+  scaleHash(hash, model->primalTolerance());
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    scaleHash(hash, usefulColumn[iColumn] + columnLength[iColumn]);
+    scaleHash(hash, columnUpper[iColumn] - columnLower[iColumn]);
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      hash[0] = (hash[0] ^ static_cast< unsigned int >(row[j])) * 16777619U;
+      scaleHash(hash, elementByColumn[j]);
+    }
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    scaleHash(hash, rowUpper[iRow] - rowLower[iRow]);
+}
+#if ABOCA_LITE
+/* One scaling pass over part of row copy or column copy.
+   If which (lengths) is NULL then by row and usefulness is
+   checked for each element, otherwise for each column.
+   numberAdded 0 - equilibrium - work is 1/largest
+               1 - geometric - work is 1/sqrt(smallest*largest)
+                   and bestPossible,upperTheta are largest,smallest scaled
+               2 - just smallest ratio in theta
+   lower is scale of other dimension */
+static void scaleBit(clpTempInfo &info)
+{
+  const CoinBigIndex *COIN_RESTRICT start = info.start;
+  const int *COIN_RESTRICT length = info.which;
+  const int *COIN_RESTRICT index = info.row;
+  const double *COIN_RESTRICT element = info.element;
+  const unsigned char *COIN_RESTRICT useful = info.status;
+  const double *COIN_RESTRICT otherScale = info.lower;
+  double *COIN_RESTRICT scale = info.work;
+  int type = info.numberAdded;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  double overallLargest = 0.0;
+  double overallSmallest = 1.0e50;
+  for (int i = first; i < last; i++) {
+    CoinBigIndex startThis = start[i];
+    CoinBigIndex endThis;
+    if (length) {
+      if (!useful[i])
+        continue;
+      endThis = startThis + length[i];
+    } else {
+      endThis = start[i + 1];
+    }
+    double largest = (type == 0) ? 1.0e-10 : ((type == 1) ? 1.0e-50 : 1.0e-20);
+    double smallest = 1.0e50;
+    for (CoinBigIndex j = startThis; j < endThis; j++) {
+      int iOther = index[j];
+      if (length || useful[iOther]) {
+        double value = fabs(element[j]);
+        if (otherScale)
+          value *= otherScale[iOther];
+        largest = CoinMax(largest, value);
+        smallest = CoinMin(smallest, value);
+      }
+    }
+    if (type == 0) {
+      scale[i] = 1.0 / largest;
+    } else if (type == 1) {
+#ifdef SQRT_ARRAY
+      scale[i] = smallest * largest;
+#else
+      scale[i] = 1.0 / sqrt(smallest * largest);
+      overallLargest = CoinMax(largest * scale[i], overallLargest);
+      overallSmallest = CoinMin(smallest * scale[i], overallSmallest);
+#endif
+    } else {
+      if (overallSmallest * largest > smallest)
+        overallSmallest = smallest / largest;
+    }
+  }
+  info.bestPossible = overallLargest;
+  info.upperTheta = overallSmallest;
+  info.theta = overallSmallest;
+}
+/* Does a scaling pass (see scaleBit) in parallel -
+   returns false if not worth it */
+static bool scaleParallel(int type, int number, CoinBigIndex numberElements,
+  const CoinBigIndex *start, const int *length, const int *index,
+  const double *element, const char *useful, const double *otherScale,
+  double *scale, double &overallLargest, double &overallSmallest)
+{
+  int numberThreads = abcState();
+  if (numberThreads < 2 || numberElements < 100000 * numberThreads)
+    return false;
+  clpTempInfo info[ABOCA_LITE];
+  int chunk = (number + numberThreads - 1) / numberThreads;
+  int n = 0;
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].start = start;
+    info[i].which = const_cast< int * >(length);
+    info[i].row = index;
+    info[i].element = element;
+    info[i].status = reinterpret_cast< const unsigned char * >(useful);
+    info[i].lower = otherScale;
+    info[i].work = scale;
+    info[i].numberAdded = type;
+    info[i].startColumn = n;
+    info[i].numberToDo = CoinMax(0, CoinMin(chunk, number - n));
+    n += chunk;
+  }
+  for (int i = 0; i < numberThreads; i++)
+    cilk_spawn scaleBit(info[i]);
+  cilk_sync;
+  for (int i = 0; i < numberThreads; i++) {
+    if (type == 1) {
+      overallLargest = CoinMax(overallLargest, info[i].bestPossible);
+      overallSmallest = CoinMin(overallSmallest, info[i].upperTheta);
+    } else if (type == 2) {
+      overallSmallest = CoinMin(overallSmallest, info[i].theta);
+    }
+  }
+  return true;
+}
+#endif
 #ifdef SQRT_ARRAY
 static void doSqrts(double *array, int n)
 {
@@ -4341,6 +4506,20 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
 	      assert(usefulColumn[iColumn]==0);
 	  }
 #endif
+    // see if scale factors can be reused
+    bool cacheHit = false;
+    unsigned int hash[2] = { 0, 0 };
+    if ((flags_ & 64) != 0) {
+      scaleCacheKey(model, matrix_, usefulColumn, hash);
+      if (scaleCache_ && scaleCache_[0] == numberRows && scaleCache_[1] == numberColumns
+        && scaleCache_[2] == hash[0] && scaleCache_[3] == hash[1]) {
+        CoinMemcpyN(scaleCache_ + CLP_SCALE_CACHE_KEY, numberRows, rowScale);
+        CoinMemcpyN(scaleCache_ + CLP_SCALE_CACHE_KEY + numberRows, numberColumns,
+          columnScale);
+        cacheHit = true;
+        finished = true;
+      }
+    }
     while (!finished) {
       int numberPass = 3;
       overallLargest = -1.0e-20;
@@ -4349,6 +4528,11 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
       ClpFillN(columnScale, numberColumns, 1.0);
       if (scalingMethod == 1 || scalingMethod == 3) {
         // Maximum in each row
+#if ABOCA_LITE
+        if (!scaleParallel(0, numberRows, rowCopy->getNumElements(), rowStart,
+              NULL, column, element, usefulColumn, NULL, rowScale,
+              overallLargest, overallSmallest))
+#endif
         for (iRow = 0; iRow < numberRows; iRow++) {
           CoinBigIndex j;
           largest = 1.0e-10;
@@ -4380,6 +4564,11 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
           overallSmallest = 1.0e50;
           numberPass--;
           // Geometric mean on row scales
+#if ABOCA_LITE
+          if (!scaleParallel(1, numberRows, rowCopy->getNumElements(), rowStart,
+                NULL, column, element, usefulColumn, columnScale, rowScale,
+                overallLargest, overallSmallest))
+#endif
           for (iRow = 0; iRow < numberRows; iRow++) {
             CoinBigIndex j;
             largest = 1.0e-50;
@@ -4431,6 +4620,13 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
           if (numberPass == 1)
             break;
           // Geometric mean on column scales
+#if ABOCA_LITE && !defined(USE_OBJECTIVE)
+          double dummyLargest = 0.0;
+          double dummySmallest = 1.0e50;
+          if (!scaleParallel(1, numberColumns, matrix_->getNumElements(), columnStart,
+                columnLength, row, elementByColumn, usefulColumn, rowScale, columnScale,
+                dummyLargest, dummySmallest))
+#endif
           for (iColumn = 0; iColumn < numberColumns; iColumn++) {
             if (usefulColumn[iColumn]) {
               CoinBigIndex j;
@@ -4484,6 +4680,11 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
       // See what smallest will be if largest is 1.0
       if (model->scalingFlag() != 5) {
         overallSmallest = 1.0e50;
+#if ABOCA_LITE
+        if (!scaleParallel(2, numberColumns, matrix_->getNumElements(), columnStart,
+              columnLength, row, elementByColumn, usefulColumn, rowScale, NULL,
+              overallLargest, overallSmallest))
+#endif
         for (iColumn = 0; iColumn < numberColumns; iColumn++) {
           if (usefulColumn[iColumn]) {
             CoinBigIndex j;
@@ -4553,7 +4754,7 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
     char *usedRow = reinterpret_cast< char * >(inverseRowScale);
     memset(usedRow, 0, numberRows);
     //printf("scaling %d\n",model->scalingFlag());
-    if (model->scalingFlag() != 5) {
+    if (model->scalingFlag() != 5 && !cacheHit) {
       for (iColumn = 0; iColumn < numberColumns; iColumn++) {
         if (columnUpper[iColumn] > columnLower[iColumn] + 1.0e-12) {
           //if (usefulColumn[iColumn]) {
@@ -4596,6 +4797,23 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
         }
       }
     }
+    if (cacheHit) {
+      overallSmallest = scaleCache_[4];
+      overallLargest = scaleCache_[5];
+    } else if ((flags_ & 64) != 0) {
+      // keep for next time
+      delete[] scaleCache_;
+      scaleCache_ = new double[CLP_SCALE_CACHE_KEY + numberRows + numberColumns];
+      scaleCache_[0] = numberRows;
+      scaleCache_[1] = numberColumns;
+      scaleCache_[2] = hash[0];
+      scaleCache_[3] = hash[1];
+      scaleCache_[4] = overallSmallest;
+      scaleCache_[5] = overallLargest;
+      CoinMemcpyN(rowScale, numberRows, scaleCache_ + CLP_SCALE_CACHE_KEY);
+      CoinMemcpyN(columnScale, numberColumns,
+        scaleCache_ + CLP_SCALE_CACHE_KEY + numberRows);
+    }
     model->messageHandler()->message(CLP_PACKEDSCALE_FINAL, *model->messagesPointer())
       << overallSmallest
       << overallLargest
@@ -4734,7 +4952,8 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
           elementsInThisRow[j] *= scale * columnScale[iColumn];
         }
       }
-      if ((model->specialOptions() & 262144) != 0) {
+      // no scaled copy if lean memory - scale on the fly instead
+      if ((model->specialOptions() & 262144) != 0 && (!simplex || (simplex->moreSpecialOptions() & 536870912) == 0)) {
         //if ((model->specialOptions()&(COIN_CBC_USING_CLP|16384))!=0) {
         //if (model->inCbcBranchAndBound()&&false) {
         // copy without gaps
@@ -5815,6 +6034,21 @@ void ClpPackedMatrix::releaseSpecialColumnCopy()
   delete columnCopy_;
   columnCopy_ = NULL;
 }
+/* Approximate bytes used - column copy, special row copy,
+   special column copy and scale cache in that order */
+void ClpPackedMatrix::memoryUsage(double *bytes) const
+{
+  int majorDim = matrix_->getMajorDim();
+  bytes[0] = static_cast< double >(matrix_->getNumElements()) * (sizeof(double) + sizeof(int))
+    + static_cast< double >(majorDim) * (sizeof(CoinBigIndex) + sizeof(int));
+  // special copies hold elements and indices again in blocks
+  bytes[1] = rowCopy_ ? bytes[0] : 0.0;
+  bytes[2] = columnCopy_ ? bytes[0] : 0.0;
+  if (scaleCache_)
+    bytes[3] = (CLP_SCALE_CACHE_KEY + scaleCache_[0] + scaleCache_[1]) * sizeof(double);
+  else
+    bytes[3] = 0.0;
+}
 // Correct sequence in and out to give true value
 void ClpPackedMatrix::correctSequence(const ClpSimplex *model, int &sequenceIn, int &sequenceOut)
 {
@@ -5886,6 +6120,7 @@ ClpPackedMatrix2::ClpPackedMatrix2()
   , count_(NULL)
   , rowStart_(NULL)
   , column_(NULL)
+  , elementFloat_(NULL)
   , work_(NULL)
 {
 #ifdef THREAD
@@ -5903,6 +6138,7 @@ ClpPackedMatrix2::ClpPackedMatrix2(ClpSimplex *, const CoinPackedMatrix *rowCopy
   , count_(NULL)
   , rowStart_(NULL)
   , column_(NULL)
+  , elementFloat_(NULL)
   , work_(NULL)
 {
 #ifdef THREAD
@@ -5988,10 +6224,41 @@ offset_[numberBlocks_] = numberColumns;
 int nRow = numberBlocks_ * numberRows_;
 count_ = new unsigned short[nRow];
 memset(count_, 0, nRow * sizeof(unsigned short));
-rowStart_ = new CoinBigIndex[nRow + numberRows_ + 1];
 CoinBigIndex nElement = rowStart[numberRows_];
-rowStart_[nRow + numberRows_] = nElement;
+#ifndef CLP_PACKED_BIG_INDEX
+if (static_cast< double >(nElement) >= 4294967295.0) {
+  // offsets would not fit in 32 bits - use normal code
+  delete[] count_;
+  count_ = NULL;
+  delete[] offset_;
+  offset_ = NULL;
+#ifdef THREAD
+  delete[] threadId_;
+  threadId_ = NULL;
+  delete[] info_;
+  info_ = NULL;
+#endif
+  numberBlocks_ = 0;
+  return;
+}
+#endif
+rowStart_ = new ClpPackedIndex[nRow + numberRows_ + 1];
+rowStart_[nRow + numberRows_] = static_cast< ClpPackedIndex >(nElement);
 column_ = new unsigned short[nElement];
+// See if elements can be held as float
+{
+  CoinBigIndex j;
+  for (j = 0; j < nElement; j++) {
+    double value = element[j];
+    if (static_cast< double >(static_cast< float >(value)) != value)
+      break;
+  }
+  if (j == nElement) {
+    elementFloat_ = new float[nElement];
+    for (j = 0; j < nElement; j++)
+      elementFloat_[j] = static_cast< float >(element[j]);
+  }
+}
 // assumes int <= double
 int sizeWork = 6 * numberBlocks_;
 work_ = new double[sizeWork];
@@ -6053,6 +6320,7 @@ ClpPackedMatrix2::ClpPackedMatrix2(const ClpPackedMatrix2 &rhs)
     rowStart_ = CoinCopyOfArray(rhs.rowStart_, nRow + numberRows_ + 1);
     CoinBigIndex nElement = rowStart_[nRow + numberRows_];
     column_ = CoinCopyOfArray(rhs.column_, nElement);
+    elementFloat_ = CoinCopyOfArray(rhs.elementFloat_, nElement);
     int sizeWork = 6 * numberBlocks_;
     work_ = CoinCopyOfArray(rhs.work_, sizeWork);
 #ifdef THREAD
@@ -6064,6 +6332,7 @@ ClpPackedMatrix2::ClpPackedMatrix2(const ClpPackedMatrix2 &rhs)
     count_ = NULL;
     rowStart_ = NULL;
     column_ = NULL;
+    elementFloat_ = NULL;
     work_ = NULL;
 #ifdef THREAD
     threadId_ = NULL;
@@ -6080,6 +6349,7 @@ ClpPackedMatrix2::~ClpPackedMatrix2()
   delete[] count_;
   delete[] rowStart_;
   delete[] column_;
+  delete[] elementFloat_;
   delete[] work_;
 #ifdef THREAD
   delete[] threadId_;
@@ -6100,6 +6370,7 @@ ClpPackedMatrix2::operator=(const ClpPackedMatrix2 &rhs)
     delete[] count_;
     delete[] rowStart_;
     delete[] column_;
+    delete[] elementFloat_;
     delete[] work_;
 #ifdef THREAD
     delete[] threadId_;
@@ -6112,6 +6383,7 @@ ClpPackedMatrix2::operator=(const ClpPackedMatrix2 &rhs)
       rowStart_ = CoinCopyOfArray(rhs.rowStart_, nRow + numberRows_ + 1);
       CoinBigIndex nElement = rowStart_[nRow + numberRows_];
       column_ = CoinCopyOfArray(rhs.column_, nElement);
+      elementFloat_ = CoinCopyOfArray(rhs.elementFloat_, nElement);
       int sizeWork = 6 * numberBlocks_;
       work_ = CoinCopyOfArray(rhs.work_, sizeWork);
 #ifdef THREAD
@@ -6123,6 +6395,7 @@ ClpPackedMatrix2::operator=(const ClpPackedMatrix2 &rhs)
       count_ = NULL;
       rowStart_ = NULL;
       column_ = NULL;
+      elementFloat_ = NULL;
       work_ = NULL;
 #ifdef THREAD
       threadId_ = NULL;
@@ -6217,13 +6490,15 @@ static int dualColumn0(const ClpSimplex *model, double *spare,
   *posFreePtr = posFree;
   return numberRemaining;
 }
+// element may be double or float (if all exactly representable)
+template < class T >
 static int doOneBlock(double *array, int *index,
-  const double *pi, const CoinBigIndex *rowStart, const double *element,
+  const double *pi, const ClpPackedIndex *rowStart, const T *element,
   const unsigned short *column, int numberInRowArray, int numberLook)
 {
   int iWhich = 0;
-  CoinBigIndex nextN = 0;
-  CoinBigIndex nextStart = 0;
+  ClpPackedIndex nextN = 0;
+  ClpPackedIndex nextStart = 0;
   double nextPi = 0.0;
   for (; iWhich < numberInRowArray; iWhich++) {
     nextStart = rowStart[0];
@@ -6237,8 +6512,8 @@ static int doOneBlock(double *array, int *index,
   int i;
   while (iWhich < numberInRowArray) {
     double value = nextPi;
-    CoinBigIndex j = nextStart;
-    CoinBigIndex n = nextN;
+    ClpPackedIndex j = nextStart;
+    ClpPackedIndex n = nextN;
     // get next
     iWhich++;
     for (; iWhich < numberInRowArray; iWhich++) {
@@ -6251,7 +6526,7 @@ static int doOneBlock(double *array, int *index,
         break;
       }
     }
-    CoinBigIndex end = j + n;
+    ClpPackedIndex end = j + n;
     //coin_prefetch_const(element+rowStart_[i+1]);
     //coin_prefetch_const(column_+rowStart_[i+1]);
     if (n < 100) {
@@ -6373,17 +6648,27 @@ static int doOneBlock(double *array, int *index,
 static void *doOneBlockThread(void *voidInfo)
 {
   dualColumn0Struct *info = (dualColumn0Struct *)voidInfo;
-  *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
-    info->rowStart, info->element, info->column,
-    info->numberInRowArray, info->numberLook);
+  if (info->elementFloat)
+    *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
+      info->rowStart, info->elementFloat, info->column,
+      info->numberInRowArray, info->numberLook);
+  else
+    *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
+      info->rowStart, info->element, info->column,
+      info->numberInRowArray, info->numberLook);
   return NULL;
 }
 static void *doOneBlockAnd0Thread(void *voidInfo)
 {
   dualColumn0Struct *info = (dualColumn0Struct *)voidInfo;
-  *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
-    info->rowStart, info->element, info->column,
-    info->numberInRowArray, info->numberLook);
+  if (info->elementFloat)
+    *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
+      info->rowStart, info->elementFloat, info->column,
+      info->numberInRowArray, info->numberLook);
+  else
+    *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
+      info->rowStart, info->element, info->column,
+      info->numberInRowArray, info->numberLook);
   *(info->numberOutPtr) = dualColumn0(info->model, info->spare,
     info->spareIndex, (const double *)info->arrayTemp,
     (const int *)info->indexTemp, *(info->numberInPtr),
@@ -6421,11 +6706,11 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
   double *element = const_cast< double * >(rowCopy->getElements());
   const CoinBigIndex *rowStart = rowCopy->getVectorStarts();
   int i;
-  CoinBigIndex *rowStart2 = rowStart_;
+  ClpPackedIndex *rowStart2 = rowStart_;
   if (!dualColumn) {
     for (i = 0; i < numberInRowArray; i++) {
       int iRow = whichRow[i];
-      CoinBigIndex start = rowStart[iRow];
+      ClpPackedIndex start = static_cast< ClpPackedIndex >(rowStart[iRow]);
       *rowStart2 = start;
       unsigned short *count1 = count_ + iRow * numberBlocks_;
       int put = 0;
@@ -6508,7 +6793,7 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
         }
         break;
       }
-      CoinBigIndex start = rowStart[iRow];
+      ClpPackedIndex start = static_cast< ClpPackedIndex >(rowStart[iRow]);
       *rowStart2 = start;
       unsigned short *count1 = count_ + iRow * numberBlocks_;
       int put = 0;
@@ -6534,8 +6819,12 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
       offset = numberNonZero;
       double *arrayTemp = array + offset;
       int *indexTemp = index + offset;
-      iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
-        element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+      if (elementFloat_)
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          elementFloat_, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+      else
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
       int number = iwork[0];
       for (i = 0; i < number; i++) {
         //double value = arrayTemp[i];
@@ -6554,6 +6843,7 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
       infoPtr->pi = pi;
       infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
       infoPtr->element = element;
+      infoPtr->elementFloat = elementFloat_;
       infoPtr->column = column_;
       infoPtr->numberInRowArray = numberInRowArray;
       infoPtr->numberLook = offset_[iBlock + 1] - offset;
@@ -6569,8 +6859,12 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
       offset2 = numberRemaining;
       double *arrayTemp = array + offset;
       int *indexTemp = index + offset;
-      iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
-        element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+      if (elementFloat_)
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          elementFloat_, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+      else
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
       iwork[1] = dualColumn0(model, spare + offset2,
         spareIndex + offset2,
         arrayTemp, indexTemp,
@@ -6624,6 +6918,7 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
       infoPtr->pi = pi;
       infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
       infoPtr->element = element;
+      infoPtr->elementFloat = elementFloat_;
       infoPtr->column = column_;
       infoPtr->numberInRowArray = numberInRowArray;
       infoPtr->numberLook = offset_[iBlock + 1] - offset;
@@ -6753,8 +7048,31 @@ ClpPackedMatrix3::ClpPackedMatrix3()
 #include <immintrin.h>
 //#include <fmaintrin.h>
 #endif
+#ifndef CLP_L2_CACHE_SIZE
+// used if cache size can not be found
+#define CLP_L2_CACHE_SIZE 262144
+#endif
+#if !defined(_MSC_VER)
+#include <unistd.h>
+#endif
+// Size of level 2 cache in bytes
+static int clpL2CacheSize()
+{
+  static int cacheSize = -1;
+  if (cacheSize < 0) {
+    int size = CLP_L2_CACHE_SIZE;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    long sysSize = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (sysSize > 0)
+      size = static_cast< int >(CoinMin(sysSize, 64L * 1024 * 1024));
+#endif
+    cacheSize = size;
+  }
+  return cacheSize;
+}
 /* Constructor from copy. */
-ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *columnCopy)
+ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *columnCopy,
+  int cacheSize)
   : numberBlocks_(0)
   , numberColumns_(0)
   , numberColumnsWithGaps_(0)
@@ -6812,6 +7130,9 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
 #define MINBLOCK 6
 #define MAXBLOCK 100
 #define GOODBLOCKSIZE 128
+// limits on block size if sized from cache
+#define MINGOODBLOCKSIZE 32
+#define MAXGOODBLOCKSIZE 1024
 #define MAXUNROLL 10
 #define MAX_ONES 32 // must be power of 2
   int maxBlock = MAXBLOCK;
@@ -6850,6 +7171,24 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
       }
     }
   }
+  /* Columns per block for each length.  If sized from cache then the
+     elements and rows of a block plus its share of output take about
+     a quarter of level 2 cache so short columns go in big blocks and
+     long ones in small blocks. */
+  if (cacheSize < 0)
+    cacheSize = clpL2CacheSize();
+  int *goodSize = new int[maxCheck + 1];
+  for (int i = 0; i <= maxCheck; i++) {
+    int size = GOODBLOCKSIZE;
+    if (cacheSize && i < maxCheck) {
+      int bytesPerColumn = nElsLookup[i] * static_cast< int >(sizeof(double) + sizeof(int))
+        + static_cast< int >(sizeof(int) + 3 * sizeof(double));
+      size = (cacheSize / 4) / bytesPerColumn;
+      size = CoinMax(MINGOODBLOCKSIZE, CoinMin(MAXGOODBLOCKSIZE, size));
+      size = roundDown(size);
+    }
+    goodSize[i] = size;
+  }
   CoinBigIndex nels = 0;
   int iColumn;
   // get matrix data pointers
@@ -6916,15 +7255,15 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
 	int nEls = nElsLookup[i];
 	nInOdd += n * nEls;
       } else {
-	largestBlock = CoinMax(largestBlock, n);
+	largestBlock = CoinMax(largestBlock, CoinMin(n, goodSize[i]));
 	int nMakeOdd = n%makeOdd;
 	counts2[i]=n-nMakeOdd;
 	nOdd += nMakeOdd;
 	int nEls = nElsLookup[i];
 	nInOdd += nMakeOdd * nEls;
-	while (n>GOODBLOCKSIZE) {
+	while (n>goodSize[i]) {
 	  numberBlocks_++;
-	  n -= GOODBLOCKSIZE;
+	  n -= goodSize[i];
 	}
 	numberBlocks_++;
       }
@@ -6967,7 +7306,7 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
       counts2[i]=n-nMakeOdd;
     }
   }
-  maxBlockSize_ = CoinMin(largestBlock,GOODBLOCKSIZE);
+  maxBlockSize_ = largestBlock;
   //#define OUT_BLOCK_ROWS
 #ifndef OUT_BLOCK_ROWS
   // add in some rows
@@ -7038,9 +7377,9 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
 #endif
     while (nCol>=COIN_AVX2) {
       blockStruct *block = block_ + nBlock;
-      int n = CoinMin(nCol,GOODBLOCKSIZE);
+      int n = CoinMin(nCol,goodSize[i]);
       n -= n % COIN_AVX2;
-      nCol -= GOODBLOCKSIZE;
+      nCol -= goodSize[i];
       nBlock++;
       block->startIndices_ = nTotal;
       block->startElements_ = nelsOthers;
@@ -7070,7 +7409,35 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
   int rowsOne[MAX_ONES];
   int rowsOther[MAX_ONES];
   double elsOther[MAX_ONES];
-  for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+  /* Row tiling - if pi will not fit in cache then fill blocks in order
+     of first row (in tiles of rows which fit in half the cache) so
+     consecutive columns gather from same part of pi. */
+  int *order = NULL;
+  int rowsPerTile = cacheSize / static_cast< int >(2 * sizeof(double));
+  if (rowsPerTile && numberRows > 2 * rowsPerTile) {
+    int numberTiles = (numberRows + rowsPerTile - 1) / rowsPerTile;
+    order = new int[2 * numberColumns + numberTiles + 1];
+    int *whichTile = order + numberColumns;
+    int *tileStart = whichTile + numberColumns;
+    CoinZeroN(tileStart, numberTiles + 1);
+    for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+      int firstRow = numberRows;
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+        if (elementByColumn[j])
+          firstRow = CoinMin(firstRow, row[j]);
+      }
+      int iTile = (firstRow < numberRows) ? firstRow / rowsPerTile : 0;
+      whichTile[iColumn] = iTile;
+      tileStart[iTile + 1]++;
+    }
+    for (int iTile = 0; iTile < numberTiles; iTile++)
+      tileStart[iTile + 1] += tileStart[iTile];
+    for (iColumn = 0; iColumn < numberColumns; iColumn++)
+      order[tileStart[whichTile[iColumn]]++] = iColumn;
+  }
+  for (int jColumn = 0; jColumn < numberColumns; jColumn++) {
+    iColumn = order ? order[jColumn] : jColumn;
     CoinBigIndex start = columnStart[iColumn];
     int n = columnLength[iColumn];
     CoinBigIndex end = start + n;
@@ -7095,7 +7462,7 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
       if (iBlock >= 0 && blockNumber[iColumn]==-2) {
         blockStruct *block = block_ + iBlock;
         int k = block->numberInBlock_;
-	if (k==GOODBLOCKSIZE) {
+	if (k==goodSize[plusN]) {
 	  // get new block
 	  iBlock++;
 	  counts[plusN]=iBlock;
@@ -7253,6 +7620,8 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
   //printf("%d chunks for %d blocks\n",numberChunks_,numberBlocks_);
   assert(numberChunks_ <= 2 * PRICE_USE_CHUNKS);
 #endif
+  delete[] order;
+  delete[] goodSize;
   delete[] counts;
 }
 /* Destructor */
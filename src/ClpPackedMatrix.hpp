@@ -333,6 +333,20 @@ public:
   }
   /// Say we don't want special column copy
   void releaseSpecialColumnCopy();
+  /** Say we want scale factors kept so that scale() can reuse them
+      if matrix, bounds and scaling options are unchanged */
+  inline void setScaleCache(bool yesNo)
+  {
+    flags_ = yesNo ? (flags_ | 64) : (flags_ & (~64));
+  }
+  /// Are scale factors kept
+  inline bool scaleCache() const
+  {
+    return ((flags_ & 64) != 0);
+  }
+  /** Approximate bytes used - column copy, special row copy,
+      special column copy and scale cache in that order */
+  void memoryUsage(double *bytes) const;
   /// Are there zeros?
   inline bool zeros() const
   {
@@ -494,14 +508,26 @@ protected:
          4 - has special row copy
          8 - has special column copy
          16 - wants special column copy
+         64 - wants scale factors cached
      */
   mutable int flags_;
   /// Special row copy
   ClpPackedMatrix2 *rowCopy_;
   /// Special column copy
   ClpPackedMatrix3 *columnCopy_;
+  /** Cached scale factors - key (sizes, hash and smallest and
+      largest) then row scales then column scales */
+  mutable double *scaleCache_;
   //@}
 };
+/* Element offsets in ClpPackedMatrix2 are held in 32 bits (and checked)
+   even if CoinBigIndex is 64 bit so that the pricing loops move less
+   memory - define CLP_PACKED_BIG_INDEX to keep CoinBigIndex */
+#ifndef CLP_PACKED_BIG_INDEX
+typedef unsigned int ClpPackedIndex;
+#else
+typedef CoinBigIndex ClpPackedIndex;
+#endif
 #ifdef THREAD
 #include <pthread.h>
 typedef struct {
@@ -519,8 +545,9 @@ typedef struct {
   int *numberOutPtr;
   const unsigned short *count;
   const double *pi;
-  const CoinBigIndex *rowStart;
+  const ClpPackedIndex *rowStart;
   const double *element;
+  const float *elementFloat;
   const unsigned short *column;
   int offset;
   int numberInRowArray;
@@ -545,6 +572,11 @@ public:
   {
     return rowStart_ != NULL;
   }
+  /// Returns true if elements are held as float (all exactly representable)
+  inline bool floatElements() const
+  {
+    return elementFloat_ != NULL;
+  }
   //@}
 
   /**@name Constructors, destructor */
@@ -576,10 +608,13 @@ protected:
   int *offset_;
   /// Counts of elements in each part of row
   mutable unsigned short *count_;
-  /// Row starts
-  mutable CoinBigIndex *rowStart_;
+  /// Row starts (32 bit unless CLP_PACKED_BIG_INDEX)
+  mutable ClpPackedIndex *rowStart_;
   /// columns within block
   unsigned short *column_;
+  /** Copy of row copy elements as float if all exactly representable
+      (so half the memory traffic) - otherwise NULL */
+  float *elementFloat_;
   /// work arrays
   double *work_;
 #ifdef THREAD
@@ -638,8 +673,11 @@ public:
   //@{
   /** Default constructor. */
   ClpPackedMatrix3();
-  /** Constructor from copy. */
-  ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *columnCopy);
+  /** Constructor from copy.
+      cacheSize is level 2 cache in bytes used to size blocks and decide
+      on row tiling, -1 finds it and 0 gives old fixed blocks. */
+  ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *columnCopy,
+    int cacheSize = -1);
   /** Destructor */
   virtual ~ClpPackedMatrix3();
   //@}
@@ -668,6 +706,16 @@ public:
   int redoInfeasibilities(const ClpSimplex *model,
     ClpPrimalColumnSteepest *pivotChoose,
     int type);
+  /// Number of blocks
+  inline int numberBlocks() const
+  {
+    return numberBlocks_;
+  }
+  /// Maximum number of columns in any block
+  inline int maximumBlockSize() const
+  {
+    return maxBlockSize_;
+  }
   /// Get temporary array (aligned)
   //@}
 
@@ -1047,7 +1047,8 @@ void ClpParameters::addClpKwdParams() {
       "fact!orization", "Which factorization to use",
 #ifndef ABC_INHERIT
       "The default is to use the normal CoinFactorization, but other choices "
-      "are a dense one, OSL's, or one designed for small problems."
+      "are a dense one, OSL's, or one designed for small problems.  "
+      "Automatic chooses one of these from size and density of the model."
 #else
       "Normally the default is to use the normal CoinFactorization, but other "
       "choices are a dense one, OSL's, or one designed for small problems. "
@@ -1060,6 +1061,7 @@ void ClpParameters::addClpKwdParams() {
   parameters_[ClpParam::FACTORIZATION]->appendKwd("dense");
   parameters_[ClpParam::FACTORIZATION]->appendKwd("simple");
   parameters_[ClpParam::FACTORIZATION]->appendKwd("osl");
+  parameters_[ClpParam::FACTORIZATION]->appendKwd("auto!matic");
 
   parameters_[ClpParam::GAMMA]->setup("gamma!(Delta)",
                                      "Whether to regularize barrier", 
@@ -1154,21 +1156,25 @@ void ClpParameters::addClpKwdParams() {
 #ifndef COIN_AVX2
   parameters_[ClpParam::VECTOR]->setup(
       "vector", "Whether to use vector? Form of matrix in simplex", 
-      "If this is on ClpPackedMatrix uses extra column copy in odd format.",
+      "If this is on ClpPackedMatrix uses extra column copy in odd format. "
+      "If pool then if the matrix has few different values it is stored "
+      "as a ClpPoolMatrix.",
       CoinParam::displayPriorityLow);
   parameters_[ClpParam::VECTOR]->appendKwd("off");
   parameters_[ClpParam::VECTOR]->appendKwd("on");
+  parameters_[ClpParam::VECTOR]->appendKwd("pool");
 #else
   parameters_[ClpParam::VECTOR]->setup(
       "vector", "Try and use vector instructions in simplex", 
       "At present only for Intel architectures - but could be extended. Uses "
       "avx2 or avx512 instructions. Uses different storage for matrix - can be "
-      "of benefit without instruction set on some problems. I may add pool to "
-      "switch on a pool matrix",
+      "of benefit without instruction set on some problems. If pool then if "
+      "the matrix has few different values it is stored as a ClpPoolMatrix.",
       CoinParam::displayPriorityLow);
   parameters_[ClpParam::VECTOR]->appendKwd("off");
   parameters_[ClpParam::VECTOR]->appendKwd("on");
   parameters_[ClpParam::VECTOR]->appendKwd("ones");
+  parameters_[ClpParam::VECTOR]->appendKwd("pool");
 #endif
 }
 
@@ -2270,8 +2270,15 @@ ClpPoolMatrix::ClpPoolMatrix(const CoinPackedMatrix &rhs)
   const double *elementByColumn = rhs.getElements();
   numberColumns_ = rhs.getNumCols();
   numberRows_ = rhs.getNumRows();
-  assert(numberRows_ < (1 << CLP_POOL_MATRIX));
   elements_ = NULL;
+  if (numberRows_ >= (1 << CLP_POOL_MATRIX)) {
+    // too many rows for packed row index
+    columnStart_ = NULL;
+    stuff_ = NULL;
+    numberRows_ = -1;
+    numberColumns_ = -1;
+    return;
+  }
   columnStart_ = new CoinBigIndex[numberColumns_ + 1];
   stuff_ = new poolInfo[rhs.getNumElements()];
   int maxPool = 1 << CLP_POOL_SIZE;
@@ -2288,9 +2295,13 @@ ClpPoolMatrix::ClpPoolMatrix(const CoinPackedMatrix &rhs)
     hashThis[i].next = -1;
   }
 #endif
-  int numberElements = 0;
+  CoinBigIndex numberElements = 0;
   int hashDifferent = 0;
+  // only too many if one more than maxPool different values
+  bool tooMany = false;
   for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (tooMany)
+      break;
     CoinBigIndex k;
     columnStart_[iColumn] = numberElements;
     for (k = columnStart[iColumn]; k < columnStart[iColumn] + columnLength[iColumn];
@@ -2344,8 +2355,10 @@ ClpPoolMatrix::ClpPoolMatrix(const CoinPackedMatrix &rhs)
       assert(j == j1);
 #endif
       if (j == numberDifferent_) {
-        if (j == maxPool)
-          break; // too many
+        if (j == maxPool) {
+          tooMany = true;
+          break;
+        }
         tempDifferent[j] = value;
         numberDifferent_++;
       }
@@ -2360,7 +2373,7 @@ ClpPoolMatrix::ClpPoolMatrix(const CoinPackedMatrix &rhs)
   elements_ = new double[numberDifferent_];
   memcpy(elements_, tempDifferent, numberDifferent_ * sizeof(double));
   delete[] tempDifferent;
-  if (numberDifferent_ == maxPool) {
+  if (tooMany) {
     delete[] stuff_;
     delete[] elements_;
     delete[] columnStart_;
@@ -2369,7 +2382,8 @@ ClpPoolMatrix::ClpPoolMatrix(const CoinPackedMatrix &rhs)
     stuff_ = NULL;
     numberRows_ = -1;
     numberColumns_ = -1;
-    numberDifferent_ = -1;
+    // so caller can say how many
+    numberDifferent_ = -maxPool;
   }
 }
 
@@ -2400,9 +2414,13 @@ ClpPoolMatrix::operator=(const ClpPoolMatrix &rhs)
     delete[] stuff_;
     matrix_ = NULL;
     lengths_ = NULL;
+    elements_ = NULL;
+    columnStart_ = NULL;
+    stuff_ = NULL;
     numberRows_ = rhs.numberRows_;
     numberColumns_ = rhs.numberColumns_;
-    if (numberColumns_) {
+    numberDifferent_ = rhs.numberDifferent_;
+    if (numberColumns_ > 0) {
       columnStart_ = CoinCopyOfArray(rhs.columnStart_, numberColumns_ + 1);
       CoinBigIndex numberElements = columnStart_[numberColumns_];
       stuff_ = CoinCopyOfArray(rhs.stuff_, numberElements);
@@ -2665,8 +2683,23 @@ void ClpPoolMatrix::times(double scalar,
   const double *rowScale,
   const double *columnScale) const
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
-  createMatrix()->times(scalar, x, y);
+  if (rowScale) {
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      CoinBigIndex j;
+      double value = x[iColumn];
+      if (value) {
+        CoinBigIndex start = columnStart_[iColumn];
+        CoinBigIndex end = columnStart_[iColumn + 1];
+        value *= scalar * columnScale[iColumn];
+        for (j = start; j < end; j++) {
+          int iRow = stuff_[j].row_;
+          y[iRow] += value * elements_[stuff_[j].pool_] * rowScale[iRow];
+        }
+      }
+    }
+  } else {
+    times(scalar, x, y);
+  }
 }
 void ClpPoolMatrix::transposeTimes(double scalar,
   const double *COIN_RESTRICT x, double *COIN_RESTRICT y,
@@ -2712,7 +2745,7 @@ void ClpPoolMatrix::transposeTimes(double scalar,
     } else {
       // can use spare region
       int iRow;
-      int numberRows = matrix_->getNumRows();
+      int numberRows = numberRows_;
       for (iRow = 0; iRow < numberRows; iRow++) {
         double value = x[iRow];
         if (value)
@@ -2762,9 +2795,37 @@ void ClpPoolMatrix::transposeTimes(const ClpSimplex *model, double scalar,
   // maybe I need one in OsiSimplex
   double zeroTolerance = model->zeroTolerance();
   bool packed = rowArray->packedMode();
-  assert(packed);
   // do by column
   const double *COIN_RESTRICT rowScale = model->rowScale();
+  if (!packed) {
+    // pi already expanded - so result is not packed either
+    const double *COIN_RESTRICT columnScale = model->columnScale();
+    CoinBigIndex start = columnStart_[0];
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      CoinBigIndex end = columnStart_[iColumn + 1];
+      double value = 0.0;
+      if (!rowScale) {
+        for (CoinBigIndex j = start; j < end; j++) {
+          int iRow = stuff_[j].row_;
+          value += pi[iRow] * elements_[stuff_[j].pool_];
+        }
+      } else {
+        for (CoinBigIndex j = start; j < end; j++) {
+          int iRow = stuff_[j].row_;
+          value += pi[iRow] * elements_[stuff_[j].pool_] * rowScale[iRow];
+        }
+        value *= columnScale[iColumn];
+      }
+      start = end;
+      value *= scalar;
+      if (fabs(value) > zeroTolerance) {
+        index[numberNonZero++] = iColumn;
+        array[iColumn] = value;
+      }
+    }
+    columnArray->setNumElements(numberNonZero);
+    return;
+  }
   assert(!y->getNumElements());
   // need to expand pi into y
   assert(y->capacity() >= model->numberRows());
@@ -2864,8 +2925,8 @@ void ClpPoolMatrix::transposeTimesByRow(const ClpSimplex *model, double scalar,
   CoinIndexedVector *y,
   CoinIndexedVector *columnArray) const
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
-  createMatrix()->transposeTimesByRow(model, scalar, rowArray, y, columnArray);
+  // there is no row copy so do by column
+  transposeTimes(model, scalar, rowArray, y, columnArray);
 }
 /* Return <code>x *A in <code>z</code> but
    just for indices in y. */
@@ -3030,7 +3091,6 @@ ClpPoolMatrix::getPackedMatrix() const
 const double *
 ClpPoolMatrix::getElements() const
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
   return createMatrix()->getElements();
 }
 
@@ -3042,14 +3102,12 @@ ClpPoolMatrix::getElements() const
 const int *
 ClpPoolMatrix::getIndices() const
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
   return createMatrix()->getIndices();
 }
 const CoinBigIndex *
 ClpPoolMatrix::getVectorStarts() const
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
-  return createMatrix()->getVectorStarts();
+  return columnStart_;
 }
 /* The lengths of the major-dimension vectors. */
 const int *
@@ -3235,10 +3293,125 @@ bool ClpPoolMatrix::canDoPartialPricing() const
 void ClpPoolMatrix::partialPricing(ClpSimplex *model, double startFraction, double endFraction,
   int &bestSequence, int &numberWanted)
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
-  createMatrix()->partialPricing(model, startFraction,
-    endFraction, bestSequence,
-    numberWanted);
+  numberWanted = currentWanted_;
+  int start = static_cast< int >(startFraction * numberColumns_);
+  int end = CoinMin(static_cast< int >(endFraction * numberColumns_ + 1), numberColumns_);
+  double tolerance = model->currentDualTolerance();
+  double *COIN_RESTRICT reducedCost = model->djRegion();
+  const double *COIN_RESTRICT duals = model->dualRowSolution();
+  const double *COIN_RESTRICT cost = model->costRegion();
+  const double *COIN_RESTRICT rowScale = model->rowScale();
+  const double *COIN_RESTRICT columnScale = model->columnScale();
+  double bestDj;
+  if (bestSequence >= 0)
+    bestDj = fabs(reducedCost[bestSequence]);
+  else
+    bestDj = tolerance;
+  int sequenceOut = model->sequenceOut();
+  int saveSequence = bestSequence;
+  int iSequence;
+  for (iSequence = start; iSequence < end; iSequence++) {
+    if (iSequence != sequenceOut) {
+      ClpSimplex::Status status = model->getStatus(iSequence);
+      if (status == ClpSimplex::basic || status == ClpSimplex::isFixed)
+        continue;
+      // price straight from pool
+      double value = 0.0;
+      CoinBigIndex j;
+      if (!rowScale) {
+        for (j = columnStart_[iSequence]; j < columnStart_[iSequence + 1]; j++) {
+          int iRow = stuff_[j].row_;
+          value -= duals[iRow] * elements_[stuff_[j].pool_];
+        }
+      } else {
+        for (j = columnStart_[iSequence]; j < columnStart_[iSequence + 1]; j++) {
+          int iRow = stuff_[j].row_;
+          value -= duals[iRow] * elements_[stuff_[j].pool_] * rowScale[iRow];
+        }
+        value *= columnScale[iSequence];
+      }
+      value += cost[iSequence];
+      switch (status) {
+
+      case ClpSimplex::basic:
+      case ClpSimplex::isFixed:
+        break;
+      case ClpSimplex::isFree:
+      case ClpSimplex::superBasic:
+        value = fabs(value);
+        if (value > FREE_ACCEPT * tolerance) {
+          numberWanted--;
+          // we are going to bias towards free (but only if reasonable)
+          value *= FREE_BIAS;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      case ClpSimplex::atUpperBound:
+        if (value > tolerance) {
+          numberWanted--;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      case ClpSimplex::atLowerBound:
+        value = -value;
+        if (value > tolerance) {
+          numberWanted--;
+          if (value > bestDj) {
+            // check flagged variable and correct dj
+            if (!model->flagged(iSequence)) {
+              bestDj = value;
+              bestSequence = iSequence;
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+        }
+        break;
+      }
+    }
+    if (!numberWanted)
+      break;
+  }
+  if (bestSequence != saveSequence) {
+    // recompute dj
+    double value = 0.0;
+    CoinBigIndex j;
+    if (!rowScale) {
+      for (j = columnStart_[bestSequence]; j < columnStart_[bestSequence + 1]; j++) {
+        int iRow = stuff_[j].row_;
+        value -= duals[iRow] * elements_[stuff_[j].pool_];
+      }
+    } else {
+      for (j = columnStart_[bestSequence]; j < columnStart_[bestSequence + 1]; j++) {
+        int iRow = stuff_[j].row_;
+        value -= duals[iRow] * elements_[stuff_[j].pool_] * rowScale[iRow];
+      }
+      value *= columnScale[bestSequence];
+    }
+    reducedCost[bestSequence] = cost[bestSequence] + value;
+    savedBestSequence_ = bestSequence;
+    savedBestDj_ = reducedCost[savedBestSequence_];
+  }
+  currentWanted_ = numberWanted;
 }
 // Allow any parts of a created CoinMatrix to be deleted
 void ClpPoolMatrix::releasePackedMatrix() const
@@ -3551,10 +3724,53 @@ void ClpPoolMatrix::subsetTimes2(const ClpSimplex *model,
   unsigned int *COIN_RESTRICT reference,
   double *COIN_RESTRICT weights, double scaleFactor)
 {
-  printf("createMatrix at file %s line %d\n", __FILE__, __LINE__);
-  createMatrix()->subsetTimes2(model, dj1, pi2, dj2,
-    referenceIn, devex,
-    reference, weights, scaleFactor);
+  int number = dj1->getNumElements();
+  const int *COIN_RESTRICT index = dj1->getIndices();
+  double *COIN_RESTRICT array = dj1->denseVector();
+  assert(dj1->packedMode());
+  const double *COIN_RESTRICT rowScale = model->rowScale();
+  const double *COIN_RESTRICT columnScale = model->columnScale();
+  double *COIN_RESTRICT piWeight = pi2->denseVector();
+  bool killDjs = (scaleFactor == 0.0);
+  if (!scaleFactor)
+    scaleFactor = 1.0;
+  for (int k = 0; k < number; k++) {
+    int iColumn = index[k];
+    double pivot = array[k] * scaleFactor;
+    if (killDjs)
+      array[k] = 0.0;
+    // and do other array
+    double modification = 0.0;
+    CoinBigIndex j;
+    if (!rowScale) {
+      for (j = columnStart_[iColumn]; j < columnStart_[iColumn + 1]; j++) {
+        int iRow = stuff_[j].row_;
+        modification += piWeight[iRow] * elements_[stuff_[j].pool_];
+      }
+    } else {
+      for (j = columnStart_[iColumn]; j < columnStart_[iColumn + 1]; j++) {
+        int iRow = stuff_[j].row_;
+        modification += piWeight[iRow] * elements_[stuff_[j].pool_] * rowScale[iRow];
+      }
+      modification *= columnScale[iColumn];
+    }
+    double thisWeight = weights[iColumn];
+    double pivotSquared = pivot * pivot;
+    thisWeight += pivotSquared * devex + pivot * modification;
+    if (thisWeight < DEVEX_TRY_NORM) {
+      if (referenceIn < 0.0) {
+        // steepest
+        thisWeight = CoinMax(DEVEX_TRY_NORM, DEVEX_ADD_ONE + pivotSquared);
+      } else {
+        // exact
+        thisWeight = referenceIn * pivotSquared;
+        if (reference(iColumn))
+          thisWeight += 1.0;
+        thisWeight = CoinMax(thisWeight, DEVEX_TRY_NORM);
+      }
+    }
+    weights[iColumn] = thisWeight;
+  }
 }
 /* Set the dimensions of the matrix. In effect, append new empty
    columns/rows to the matrix. A negative number for either dimension
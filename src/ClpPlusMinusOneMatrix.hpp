@@ -291,9 +291,20 @@ protected:
 
   //@}
 };
+#ifndef CLP_POOL_MATRIX
+/* Bits used for row in ClpPoolMatrix - rest of 32 bit word is index into
+   pool of values so 24 allows 16M rows and 256 values (one byte code)
+   while 16 allows 65K rows and 65K values (two byte code).
+   0 switches off ClpPoolMatrix */
+#define CLP_POOL_MATRIX 24
+#endif
 #if CLP_POOL_MATRIX
 /** This implements a matrix with few different coefficients 
-    as derived from ClpMatrixBase.  This version only up to 65K rows
+    as derived from ClpMatrixBase.  Each element is row and index into
+    pool of values packed into one 32 bit word, so all simplex kernels
+    read a third of the data of a ClpPackedMatrix.  There is no row copy.
+    The matrix does not compute scale factors itself, but kernels apply
+    any row and column scale factors the model has.
 */
 #define CLP_POOL_SIZE 32 - CLP_POOL_MATRIX
 #if CLP_POOL_MATRIX == 16
@@ -304,7 +315,7 @@ typedef struct {
 #else
 typedef struct {
   unsigned int row_ : CLP_POOL_MATRIX;
-  unsigned short pool_ : CLP_POOL_SIZE;
+  unsigned int pool_ : CLP_POOL_SIZE;
 } poolInfo;
 #endif
 #include "ClpPackedMatrix.hpp"
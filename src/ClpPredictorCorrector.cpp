@@ -120,6 +120,7 @@ int ClpPredictorCorrector::solve()
     }
     saveObjective = objective_;
     // We are going to make matrix full rather half
+    // (even if keepTriangular as KKT factorization needs both triangles)
     objective_ = new ClpQuadraticObjective(*quadraticObj, 1);
   }
   bool allowIncreasingGap = (modeSwitch & 4) != 0;
@@ -933,6 +934,8 @@ int ClpPredictorCorrector::solve()
   if (saveObjective) {
     delete objective_;
     objective_ = saveObjective;
+    // back to unscaled matrix - forget any saved Qx
+    static_cast< ClpQuadraticObjective * >(objective_)->invalidateProduct();
     objectiveValue_ = 0.5 * (primalObjective_ + dualObjective_);
   }
   handler_->message(CLP_BARRIER_END, messages_)
@@ -1927,6 +1930,8 @@ int ClpPredictorCorrector::createSolution()
           }
         }
       }
+      // saved Qx no longer matches
+      quadraticObj->invalidateProduct();
     }
   }
   baseObjectiveNorm_ = objectiveNorm_;
@@ -22,6 +22,7 @@
 #include "ClpSimplexOther.hpp"
 #ifndef SLIM_CLP
 #include "ClpQuadraticObjective.hpp"
+#include "ClpLowRankObjective.hpp"
 #endif
 
 #include "ClpPresolve.hpp"
@@ -1935,6 +1936,17 @@ CoinPresolveMatrix* create_CoinPresolveMatrix(
         //printf("%d prohib\n",iColumn);
       }
     }
+  } else if (si->objectiveAsObject()->type() == 3) {
+    // low rank - columns with factors or diagonal can not be touched
+    char *mark = new char[cpm->ncols_];
+    memset(mark, 0, cpm->ncols_);
+    cpm->anyProhibited_ = true;
+    si->objectiveAsObject()->markNonlinear(mark);
+    for (int iColumn = 0; iColumn < cpm->ncols_; iColumn++) {
+      if (mark[iColumn])
+        cpm->setColProhibited(iColumn);
+    }
+    delete[] mark;
 #endif
   } else {
 	  cpm->anyProhibited_ = false;
@@ -2474,6 +2486,12 @@ ClpPresolve::gutsOfPresolvedModel(ClpSimplex *originalModel,
           if (mark[iColumn])
             printf("Quadratic column %d modified - may be okay\n", iColumn);
         delete[] mark;
+      } else if (originalModel->objectiveAsObject()->type() == 3) {
+        // low rank - take subset and modify linear
+        ClpLowRankObjective *newObj = static_cast< ClpLowRankObjective * >(originalModel->objectiveAsObject()->subsetClone(ncolsNow, originalColumn_));
+        CoinMemcpyN(presolvedModel_->objective(), ncolsNow, newObj->linearObjective());
+        presolvedModel_->setObjective(newObj);
+        delete newObj;
       }
 #endif
       delete[] prob->originalColumn_;
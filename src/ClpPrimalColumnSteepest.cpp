@@ -56,6 +56,9 @@ ClpPrimalColumnSteepest::ClpPrimalColumnSteepest(int mode)
   , savedPivotSequence_(-1)
   , savedSequenceOut_(-1)
   , sizeFactorization_(0)
+  , maximumCandidates_(0)
+  , numberCandidates_(0)
+  , numberMinor_(0)
 {
   type_ = 2 + 64 * mode;
 }
@@ -76,6 +79,10 @@ ClpPrimalColumnSteepest::ClpPrimalColumnSteepest(const ClpPrimalColumnSteepest &
   savedSequenceOut_ = rhs.savedSequenceOut_;
   sizeFactorization_ = rhs.sizeFactorization_;
   devex_ = rhs.devex_;
+  maximumCandidates_ = rhs.maximumCandidates_;
+  numberCandidates_ = rhs.numberCandidates_;
+  numberMinor_ = rhs.numberMinor_;
+  CoinMemcpyN(rhs.candidate_, numberCandidates_, candidate_);
   if ((model_ && model_->whatsChanged() & 1) != 0) {
     if (rhs.infeasible_) {
       infeasible_ = new CoinIndexedVector(rhs.infeasible_);
@@ -143,6 +150,10 @@ ClpPrimalColumnSteepest::operator=(const ClpPrimalColumnSteepest &rhs)
     savedSequenceOut_ = rhs.savedSequenceOut_;
     sizeFactorization_ = rhs.sizeFactorization_;
     devex_ = rhs.devex_;
+    maximumCandidates_ = rhs.maximumCandidates_;
+    numberCandidates_ = rhs.numberCandidates_;
+    numberMinor_ = rhs.numberMinor_;
+    CoinMemcpyN(rhs.candidate_, numberCandidates_, candidate_);
     delete[] weights_;
     delete[] reference_;
     reference_ = NULL;
@@ -328,6 +339,9 @@ int ClpPrimalColumnSteepest::pivotColumn(CoinIndexedVector *updates,
         }
         // Update duals and row djs
         // Do partial pricing
+        if (maximumCandidates_ && model_->clpMatrix()->type() == 1)
+          return multiplePricing(updates, spareRow2,
+            numberWanted, numberLook);
         return partialPricing(updates, spareRow2,
           numberWanted, numberLook);
       }
@@ -3179,6 +3193,8 @@ void ClpPrimalColumnSteepest::saveWeights(ClpSimplex *model, int mode)
     if (mode == 1 && !weights_)
       numberSwitched_ = 0; // Reset
   }
+  if (mode == 1)
+    numberCandidates_ = 0; // start again with multiple pricing
   // alternateWeights_ is defined as indexed but is treated oddly
   // at times
   int numberRows = model_->numberRows();
@@ -4044,6 +4060,7 @@ void ClpPrimalColumnSteepest::clearArrays()
     reference_ = NULL;
   }
   pivotSequence_ = -1;
+  numberCandidates_ = 0;
   state_ = -1;
   savedPivotSequence_ = -1;
   savedSequenceOut_ = -1;
@@ -4170,16 +4187,11 @@ void ClpPrimalColumnSteepest::switchOffSprint()
   numberSwitched_ = 10;
 }
 // Update djs doing partial pricing (dantzig)
-int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
-  CoinIndexedVector *spareRow2,
-  int numberWanted,
-  int numberLook)
+/* Updates duals for partial pricing (updates is cleared)
+   and returns dual tolerance to use */
+double ClpPrimalColumnSteepest::partialDuals(CoinIndexedVector *updates,
+  CoinIndexedVector *spareRow2)
 {
-  int number = 0;
-  int *index;
-  double *updateBy;
-  double *reducedCost;
-  double saveTolerance = model_->currentDualTolerance();
   double tolerance = model_->currentDualTolerance();
   // we can't really trust infeasibilities if there is dual error
   // this coding has to mimic coding in checkDualSolution
@@ -4198,26 +4210,185 @@ int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
   }
   if (model_->factorization()->pivots() && model_->numberPrimalInfeasibilities())
     tolerance = CoinMax(tolerance, 1.0e-15 * model_->infeasibilityCost());
-  // So partial pricing can use
-  model_->setCurrentDualTolerance(tolerance);
   model_->factorization()->updateColumnTranspose(spareRow2, updates);
-  int numberColumns = model_->numberColumns();
-
-  // Rows
-  reducedCost = model_->djRegion(0);
-
-  number = updates->getNumElements();
-  index = updates->getIndices();
-  updateBy = updates->denseVector();
-  int j;
+  int number = updates->getNumElements();
+  int *index = updates->getIndices();
+  double *updateBy = updates->denseVector();
   double *duals = model_->dualRowSolution();
-  for (j = 0; j < number; j++) {
+  for (int j = 0; j < number; j++) {
     int iSequence = index[j];
     double value = duals[iSequence];
     value -= updateBy[j];
     updateBy[j] = 0.0;
     duals[iSequence] = value;
   }
+  updates->setNumElements(0);
+  return tolerance;
+}
+/* Returns amount by which sequence is dual infeasible (0.0 if not
+   or not a candidate) and dj - djs from current duals */
+double ClpPrimalColumnSteepest::candidateValue(int iSequence, double tolerance,
+  double &dj) const
+{
+  dj = 0.0;
+  if (iSequence == model_->sequenceOut() || model_->flagged(iSequence))
+    return 0.0;
+  ClpSimplex::Status status = model_->getStatus(iSequence);
+  if (status == ClpSimplex::basic || status == ClpSimplex::isFixed)
+    return 0.0;
+  int numberColumns = model_->numberColumns();
+  const double *cost = model_->costRegion();
+  const double *duals = model_->dualRowSolution();
+  double value;
+  if (iSequence >= numberColumns) {
+    value = cost[iSequence] + duals[iSequence - numberColumns];
+  } else {
+    const CoinPackedMatrix *matrix = model_->clpMatrix()->getPackedMatrix();
+    const double *element = matrix->getElements();
+    const int *row = matrix->getIndices();
+    const CoinBigIndex *startColumn = matrix->getVectorStarts();
+    const int *length = matrix->getVectorLengths();
+    const double *rowScale = model_->rowScale();
+    value = 0.0;
+    CoinBigIndex j;
+    if (rowScale) {
+      for (j = startColumn[iSequence];
+           j < startColumn[iSequence] + length[iSequence]; j++) {
+        int jRow = row[j];
+        value -= duals[jRow] * element[j] * rowScale[jRow];
+      }
+      value = cost[iSequence] + value * model_->columnScale()[iSequence];
+    } else {
+      for (j = startColumn[iSequence];
+           j < startColumn[iSequence] + length[iSequence]; j++)
+        value -= duals[row[j]] * element[j];
+      value += cost[iSequence];
+    }
+  }
+  dj = value;
+  switch (status) {
+  case ClpSimplex::isFree:
+  case ClpSimplex::superBasic:
+    value = fabs(value);
+    if (value > FREE_ACCEPT * tolerance)
+      // we are going to bias towards free (but only if reasonable)
+      return value * FREE_BIAS;
+    return 0.0;
+  case ClpSimplex::atUpperBound:
+    return (value > tolerance) ? value : 0.0;
+  case ClpSimplex::atLowerBound:
+    return (-value > tolerance) ? -value : 0.0;
+  default:
+    return 0.0;
+  }
+}
+/* Partial pricing with list of candidates.
+   A pass prices from a random start until enough found (as partial
+   pricing) keeping best few.  Following minor iterations just reprice
+   those with updated duals until none left or enough minor iterations */
+int ClpPrimalColumnSteepest::multiplePricing(CoinIndexedVector *updates,
+  CoinIndexedVector *spareRow2,
+  int numberWanted,
+  int numberLook)
+{
+  double saveTolerance = model_->currentDualTolerance();
+  double tolerance = partialDuals(updates, spareRow2);
+  double *reducedCost = model_->djRegion();
+  int bestSequence = -1;
+  double bestValue = tolerance;
+  double bestDj = 0.0;
+  if (numberCandidates_ && numberMinor_ < maximumCandidates_) {
+    // minor iteration
+    int nKeep = 0;
+    for (int i = 0; i < numberCandidates_; i++) {
+      int iSequence = candidate_[i];
+      double dj;
+      double value = candidateValue(iSequence, tolerance, dj);
+      if (value > tolerance) {
+        candidate_[nKeep++] = iSequence;
+        if (value > bestValue) {
+          bestValue = value;
+          bestSequence = iSequence;
+          bestDj = dj;
+        }
+      }
+    }
+    numberCandidates_ = nKeep;
+    numberMinor_++;
+  }
+  if (bestSequence < 0) {
+    // major - keep best (sorted on value) as candidates
+    double candidateValues[CLP_PRIMAL_CANDIDATES + 1];
+    numberCandidates_ = 0;
+    numberMinor_ = 0;
+    int numberTotal = model_->numberRows() + model_->numberColumns();
+    int start = static_cast< int >(numberTotal * model_->randomNumberGenerator()->randomDouble());
+    int saveNumberWanted = numberWanted;
+    int iSequence = start;
+    for (int k = 0; k < numberTotal; k++) {
+      double dj;
+      double value = candidateValue(iSequence, tolerance, dj);
+      if (value > tolerance) {
+        numberWanted--;
+        if (value > bestValue) {
+          bestValue = value;
+          bestSequence = iSequence;
+          bestDj = dj;
+        }
+        // insert in list
+        int i = numberCandidates_;
+        if (i <= maximumCandidates_ || value > candidateValues[maximumCandidates_]) {
+          if (i > maximumCandidates_)
+            i = maximumCandidates_;
+          else
+            numberCandidates_++;
+          for (; i > 0 && candidateValues[i - 1] < value; i--) {
+            candidateValues[i] = candidateValues[i - 1];
+            candidate_[i] = candidate_[i - 1];
+          }
+          candidateValues[i] = value;
+          candidate_[i] = iSequence;
+        }
+        if (!numberWanted)
+          break;
+      }
+      numberLook--;
+      if (numberLook < 0 && (10 * (saveNumberWanted - numberWanted) > saveNumberWanted))
+        break; // give up
+      iSequence++;
+      if (iSequence == numberTotal)
+        iSequence = 0;
+    }
+  }
+  if (bestSequence >= 0) {
+    // take out of list
+    int nKeep = 0;
+    for (int i = 0; i < numberCandidates_; i++) {
+      if (candidate_[i] != bestSequence)
+        candidate_[nKeep++] = candidate_[i];
+    }
+    numberCandidates_ = CoinMin(nKeep, maximumCandidates_);
+    reducedCost[bestSequence] = bestDj;
+    model_->clpMatrix()->setSavedBestSequence(bestSequence);
+    model_->clpMatrix()->setSavedBestDj(bestDj);
+  } else {
+    numberCandidates_ = 0;
+  }
+  model_->setCurrentDualTolerance(saveTolerance);
+  return bestSequence;
+}
+int ClpPrimalColumnSteepest::partialPricing(CoinIndexedVector *updates,
+  CoinIndexedVector *spareRow2,
+  int numberWanted,
+  int numberLook)
+{
+  double *reducedCost;
+  double saveTolerance = model_->currentDualTolerance();
+  double tolerance = partialDuals(updates, spareRow2);
+  // So partial pricing can use
+  model_->setCurrentDualTolerance(tolerance);
+  int numberColumns = model_->numberColumns();
+  double *duals = model_->dualRowSolution();
   //#define CLP_DEBUG
 #ifdef CLP_DEBUG
   // check duals
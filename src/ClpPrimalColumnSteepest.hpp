@@ -7,6 +7,10 @@
 
 #include "ClpPrimalColumnPivot.hpp"
 #include <bitset>
+/// Maximum number of candidates kept for multiple pricing
+#ifndef CLP_PRIMAL_CANDIDATES
+#define CLP_PRIMAL_CANDIDATES 32
+#endif
 
 //#############################################################################
 class CoinIndexedVector;
@@ -82,6 +86,18 @@ public:
     CoinIndexedVector *spareRow2,
     CoinIndexedVector *spareColumn1,
     CoinIndexedVector *spareColumn2);
+  /** Updates duals for partial pricing (updates is cleared)
+         and returns dual tolerance to use */
+  double partialDuals(CoinIndexedVector *updates,
+    CoinIndexedVector *spareRow2);
+  /// Partial pricing with list of candidates (see setMultiplePricing)
+  int multiplePricing(CoinIndexedVector *updates,
+    CoinIndexedVector *spareRow2,
+    int numberWanted,
+    int numberLook);
+  /** Returns amount by which sequence is dual infeasible (0.0 if not
+         or not a candidate) and dj */
+  double candidateValue(int iSequence, double tolerance, double &dj) const;
   /// Updates two arrays for steepest
   int transposeTimes2(const CoinIndexedVector *pi1, CoinIndexedVector *dj1,
     const CoinIndexedVector *pi2, CoinIndexedVector *dj2,
@@ -152,6 +168,22 @@ public:
   virtual int numberSprintColumns(int &numberIterations) const;
   /// Switch off sprint idea
   virtual void switchOffSprint();
+  /** Multiple pricing for partial dantzig pricing (mode 4 before switch
+      or mode 5) with a column copy.  A pricing pass keeps the best
+      number candidates and up to number minor iterations choose from
+      them, with djs recomputed from current duals, before another pass.
+      0 (default) is off, maximum is CLP_PRIMAL_CANDIDATES */
+  inline void setMultiplePricing(int number)
+  {
+    maximumCandidates_ = (number < CLP_PRIMAL_CANDIDATES) ? number : CLP_PRIMAL_CANDIDATES;
+    if (maximumCandidates_ < 0)
+      maximumCandidates_ = 0;
+    numberCandidates_ = 0;
+  }
+  inline int multiplePricing() const
+  {
+    return maximumCandidates_;
+  }
 
   //@}
 
@@ -271,6 +303,14 @@ protected:
   int lastRectified_;
   // Size of factorization at invert (used to decide algorithm)
   int sizeFactorization_;
+  /// Maximum number of candidates for multiple pricing (0 off)
+  int maximumCandidates_;
+  /// Number of candidates left
+  int numberCandidates_;
+  /// Minor iterations since last pricing pass
+  int numberMinor_;
+  /// Candidates for multiple pricing
+  int candidate_[CLP_PRIMAL_CANDIDATES + 1];
   //@}
 };
 
@@ -6,6 +6,10 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
 #include "ClpFactorization.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpQuadraticObjective.hpp"
 //#############################################################################
@@ -21,10 +25,14 @@ ClpQuadraticObjective::ClpQuadraticObjective()
   objective_ = NULL;
   quadraticObjective_ = NULL;
   gradient_ = NULL;
+  productQx_ = NULL;
+  savedSolution_ = NULL;
+  numberIncremental_ = 0;
   numberColumns_ = 0;
   numberExtendedColumns_ = 0;
   activated_ = 0;
   fullMatrix_ = false;
+  keepTriangular_ = false;
 }
 
 //-------------------------------------------------------------------
@@ -57,8 +65,12 @@ ClpQuadraticObjective::ClpQuadraticObjective(const double *objective,
   else
     quadraticObjective_ = NULL;
   gradient_ = NULL;
+  productQx_ = NULL;
+  savedSolution_ = NULL;
+  numberIncremental_ = 0;
   activated_ = 1;
   fullMatrix_ = false;
+  keepTriangular_ = false;
 }
 
 //-------------------------------------------------------------------
@@ -71,6 +83,11 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   numberColumns_ = rhs.numberColumns_;
   numberExtendedColumns_ = rhs.numberExtendedColumns_;
   fullMatrix_ = rhs.fullMatrix_;
+  keepTriangular_ = rhs.keepTriangular_;
+  // product not copied as may change type
+  productQx_ = NULL;
+  savedSolution_ = NULL;
+  numberIncremental_ = 0;
   if (rhs.objective_) {
     objective_ = new double[numberExtendedColumns_];
     CoinMemcpyN(rhs.objective_, numberExtendedColumns_, objective_);
@@ -198,7 +215,11 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   : ClpObjective(rhs)
 {
   fullMatrix_ = rhs.fullMatrix_;
+  keepTriangular_ = rhs.keepTriangular_;
   objective_ = NULL;
+  productQx_ = NULL;
+  savedSolution_ = NULL;
+  numberIncremental_ = 0;
   int extra = rhs.numberExtendedColumns_ - rhs.numberColumns_;
   numberColumns_ = 0;
   numberExtendedColumns_ = numberColumns + extra;
@@ -247,6 +268,8 @@ ClpQuadraticObjective::~ClpQuadraticObjective()
 {
   delete[] objective_;
   delete[] gradient_;
+  delete[] productQx_;
+  delete[] savedSolution_;
   delete quadraticObjective_;
 }
 
@@ -258,10 +281,12 @@ ClpQuadraticObjective::operator=(const ClpQuadraticObjective &rhs)
 {
   if (this != &rhs) {
     fullMatrix_ = rhs.fullMatrix_;
+    keepTriangular_ = rhs.keepTriangular_;
     delete quadraticObjective_;
     quadraticObjective_ = NULL;
     delete[] objective_;
     delete[] gradient_;
+    invalidateProduct();
     ClpObjective::operator=(rhs);
     numberColumns_ = rhs.numberColumns_;
     numberExtendedColumns_ = rhs.numberExtendedColumns_;
@@ -356,21 +381,13 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
               }
             }
           } else {
-            // full matrix
+            // full matrix - Q*x is kept and updated
+            updateProduct(solution);
             int iColumn;
-            offset *= 2.0;
             for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-              CoinBigIndex j;
-              double value = 0.0;
-              double current = gradient_[iColumn];
-              for (j = columnQuadraticStart[iColumn];
-                   j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-                int jColumn = columnQuadratic[j];
-                double valueJ = solution[jColumn] * quadraticElement[j];
-                value += valueJ;
-              }
+              double value = productQx_[iColumn];
               offset += value * solution[iColumn];
-              gradient_[iColumn] = current + value;
+              gradient_[iColumn] += value;
             }
             offset *= 0.5;
           }
@@ -495,6 +512,7 @@ ClpQuadraticObjective::subsetClone(int numberColumns,
 // Resize objective
 void ClpQuadraticObjective::resize(int newNumberColumns)
 {
+  invalidateProduct();
   if (numberColumns_ != newNumberColumns) {
     int newExtended = newNumberColumns + (numberExtendedColumns_ - numberColumns_);
     int i;
@@ -534,6 +552,7 @@ void ClpQuadraticObjective::resize(int newNumberColumns)
 // Delete columns in  objective
 void ClpQuadraticObjective::deleteSome(int numberToDelete, const int *which)
 {
+  invalidateProduct();
   int newNumberColumns = numberColumns_ - numberToDelete;
   int newExtended = numberExtendedColumns_ - numberToDelete;
   if (objective_) {
@@ -602,6 +621,7 @@ void ClpQuadraticObjective::deleteSome(int numberToDelete, const int *which)
 void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, const CoinBigIndex *start,
   const int *column, const double *element, int numberExtended)
 {
+  invalidateProduct();
   fullMatrix_ = false;
   delete quadraticObjective_;
   quadraticObjective_ = new CoinPackedMatrix(true, numberColumns, numberColumns,
@@ -631,12 +651,14 @@ void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, cons
 }
 void ClpQuadraticObjective::loadQuadraticObjective(const CoinPackedMatrix &matrix)
 {
+  invalidateProduct();
   delete quadraticObjective_;
   quadraticObjective_ = new CoinPackedMatrix(matrix);
 }
 // Get rid of quadratic objective
 void ClpQuadraticObjective::deleteQuadraticObjective()
 {
+  invalidateProduct();
   delete quadraticObjective_;
   quadraticObjective_ = NULL;
 }
@@ -785,22 +807,21 @@ ClpQuadraticObjective::stepLength(ClpSimplex *model,
         }
       }
     } else {
-      // full matrix stored
+      // full matrix stored - b and c from Q*x so only need changed columns
+      updateProduct(solution);
       int iColumn;
       for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
         double changeI = change[iColumn];
+        double value = productQx_[iColumn];
+        b += changeI * value;
+        c += solution[iColumn] * value;
+        if (!changeI)
+          continue;
         CoinBigIndex j;
         for (j = columnQuadraticStart[iColumn];
              j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
           int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          valueJ *= elementValue;
-          a += changeI * changeJ * elementValue;
-          b += changeI * valueJ;
-          c += valueI * valueJ;
+          a += changeI * change[jColumn] * quadraticElement[j];
         }
       }
       a *= 0.5;
@@ -933,6 +954,11 @@ ClpQuadraticObjective::objectiveValue(const ClpSimplex *model, const double *sol
           }
         }
       }
+    } else if (productQx_ && !memcmp(solution, savedSolution_, numberColumns_ * sizeof(double))) {
+      // full matrix stored and have Q*x
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+        c += solution[iColumn] * productQx_[iColumn];
+      c *= 0.5;
     } else {
       // full matrix stored
       int iColumn;
@@ -1003,6 +1029,7 @@ ClpQuadraticObjective::objectiveValue(const ClpSimplex *model, const double *sol
 // Scale objective
 void ClpQuadraticObjective::reallyScale(const double *columnScale)
 {
+  invalidateProduct();
   const int *columnQuadratic = quadraticObjective_->getIndices();
   const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
   const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
@@ -1018,6 +1045,148 @@ void ClpQuadraticObjective::reallyScale(const double *columnScale)
     }
   }
 }
+/* Sets product to quadratic times solution and returns
+   solution'*quadratic*solution.  Saved product is used (and updated) */
+double
+ClpQuadraticObjective::quadraticTimes(const double *solution, double *product)
+{
+  if (!quadraticObjective_) {
+    CoinZeroN(product, numberColumns_);
+    return 0.0;
+  }
+  updateProduct(solution);
+  double value = 0.0;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    double productI = productQx_[iColumn];
+    product[iColumn] = productI;
+    value += solution[iColumn] * productI;
+  }
+  return value;
+}
+// Forgets saved product (when matrix changes)
+void ClpQuadraticObjective::invalidateProduct()
+{
+  delete[] productQx_;
+  delete[] savedSolution_;
+  productQx_ = NULL;
+  savedSolution_ = NULL;
+  numberIncremental_ = 0;
+}
+// Columns of full symmetric matrix times x (each gives one product entry)
+static void
+quadraticTimesBit(clpTempInfo &info)
+{
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.start;
+  const int *COIN_RESTRICT columnLength = info.which;
+  const int *COIN_RESTRICT column = info.row;
+  const double *COIN_RESTRICT element = info.element;
+  const double *COIN_RESTRICT x = info.work;
+  double *COIN_RESTRICT product = info.spare;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int iColumn = first; iColumn < last; iColumn++) {
+    double value = 0.0;
+    CoinBigIndex start = columnStart[iColumn];
+    CoinBigIndex end = start + columnLength[iColumn];
+    for (CoinBigIndex j = start; j < end; j++)
+      value += x[column[j]] * element[j];
+    product[iColumn] = value;
+  }
+}
+// Full recomputation after this many incremental updates
+#define CLP_QUADRATIC_REFRESH 50
+/* Makes sure productQx_ is quadratic times solution.
+   Only changed entries of solution are used unless too many changed
+   (half matrix is always done from scratch if anything changed) */
+void ClpQuadraticObjective::updateProduct(const double *solution)
+{
+  const int *columnQuadratic = quadraticObjective_->getIndices();
+  const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
+  const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
+  const double *quadraticElement = quadraticObjective_->getElements();
+  int numberChanged = numberColumns_;
+  if (productQx_ && numberIncremental_ < CLP_QUADRATIC_REFRESH) {
+    numberChanged = 0;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (solution[iColumn] != savedSolution_[iColumn])
+        numberChanged++;
+    }
+  }
+  if (!productQx_) {
+    productQx_ = new double[numberColumns_];
+    savedSolution_ = new double[numberColumns_];
+  }
+  if (!fullMatrix_) {
+    if (!numberChanged)
+      return;
+    // column only gives half of changes so do serially from scratch
+    numberIncremental_ = 0;
+    CoinMemcpyN(solution, numberColumns_, savedSolution_);
+    CoinZeroN(productQx_, numberColumns_);
+    // each off diagonal element stands for itself and its transpose
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      double valueI = solution[iColumn];
+      double sumI = 0.0;
+      for (CoinBigIndex j = columnQuadraticStart[iColumn];
+           j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
+        int jColumn = columnQuadratic[j];
+        double elementValue = quadraticElement[j];
+        sumI += solution[jColumn] * elementValue;
+        if (jColumn != iColumn)
+          productQx_[jColumn] += valueI * elementValue;
+      }
+      productQx_[iColumn] += sumI;
+    }
+  } else if (4 * numberChanged < numberColumns_) {
+    // matrix symmetric so column gives changes in product
+    if (numberChanged) {
+      numberIncremental_++;
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        double change = solution[iColumn] - savedSolution_[iColumn];
+        if (change) {
+          savedSolution_[iColumn] = solution[iColumn];
+          for (CoinBigIndex j = columnQuadraticStart[iColumn];
+               j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
+            int jColumn = columnQuadratic[j];
+            productQx_[jColumn] += change * quadraticElement[j];
+          }
+        }
+      }
+    }
+  } else {
+    numberIncremental_ = 0;
+    CoinMemcpyN(solution, numberColumns_, savedSolution_);
+#if ABOCA_LITE
+    int numberThreads = CoinMax(abcState(), 1);
+#define ABOCA_LITE_MAX ABOCA_LITE
+#else
+    const int numberThreads = 1;
+#define ABOCA_LITE_MAX 1
+#endif
+    clpTempInfo info[ABOCA_LITE_MAX];
+    int chunk = (numberColumns_ + numberThreads - 1) / numberThreads;
+    int n = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      info[i].start = columnQuadraticStart;
+      info[i].which = const_cast< int * >(columnQuadraticLength);
+      info[i].row = columnQuadratic;
+      info[i].element = quadraticElement;
+      info[i].work = savedSolution_;
+      info[i].spare = productQx_;
+      info[i].startColumn = n;
+      info[i].numberToDo = CoinMax(CoinMin(chunk, numberColumns_ - n), 0);
+      n += chunk;
+    }
+    if (numberThreads == 1) {
+      quadraticTimesBit(info[0]);
+    } else {
+      for (int i = 0; i < numberThreads; i++) {
+        cilk_spawn quadraticTimesBit(info[i]);
+      }
+      cilk_sync;
+    }
+  }
+}
 /* Given a zeroed array sets nonlinear columns to 1.
    Returns number of nonlinear columns
 */
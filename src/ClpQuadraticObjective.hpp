@@ -58,6 +58,12 @@ public:
          Returns number of nonlinear columns
       */
   virtual int markNonlinear(char *which);
+  /** Sets product to quadratic times solution (numberColumns long)
+         and returns solution'*quadratic*solution.  Half matrix is used
+         as symmetric triangle so need not be expanded to full.
+         Saved product is reused and updated (as in gradient).
+     */
+  double quadraticTimes(const double *solution, double *product);
 
   //@}
 
@@ -105,6 +111,9 @@ public:
   void loadQuadraticObjective(const CoinPackedMatrix &matrix);
   /// Get rid of quadratic objective
   void deleteQuadraticObjective();
+  /** Forgets saved product - must be called if elements of
+         quadraticObjective() are changed in place */
+  void invalidateProduct();
   //@}
   ///@name Gets and sets
   //@{
@@ -133,6 +142,27 @@ public:
   {
     return fullMatrix_;
   }
+  /** If true a half (triangular) matrix is kept as it is - ClpSimplexNonlinear
+         does not expand to full (saves memory for large dense matrices).
+         Barrier still expands as KKT factorization needs both triangles */
+  inline bool keepTriangular() const
+  {
+    return keepTriangular_;
+  }
+  inline void setKeepTriangular(bool yesNo)
+  {
+    keepTriangular_ = yesNo;
+  }
+  //@}
+
+  ///@name Private functions
+  //@{
+private:
+  /** Makes sure productQx_ is quadratic times solution.
+         Only changed entries of solution are used unless too many changed
+         or too many updates since last full (maybe parallel) computation.
+         Half matrix is recomputed from scratch when solution changes */
+  void updateProduct(const double *solution);
   //@}
 
   //---------------------------------------------------------------------------
@@ -145,12 +175,20 @@ private:
   double *objective_;
   /// Gradient
   double *gradient_;
+  /// Quadratic times savedSolution_
+  double *productQx_;
+  /// Solution used for productQx_
+  double *savedSolution_;
+  /// Number of incremental updates since productQx_ computed from scratch
+  int numberIncremental_;
   /// Useful to have number of columns about
   int numberColumns_;
   /// Also length of linear objective which could be bigger
   int numberExtendedColumns_;
   /// True if full symmetric matrix, false if half
   bool fullMatrix_;
+  /// True if half matrix should not be expanded
+  bool keepTriangular_;
   //@}
 };
 
@@ -14,6 +14,10 @@
 #endif
 #include "CoinHelperFunctions.hpp"
 #include "CoinFloatEqual.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpFactorization.hpp"
 #include "ClpPackedMatrix.hpp"
@@ -104,6 +108,18 @@ ClpSimplex::ClpSimplex(bool emptyMessages)
   , numberRefinements_(0)
   , pivotVariable_(NULL)
   , factorization_(NULL)
+  , earlyFactorization_(NULL)
+  , earlyPivots_(NULL)
+  , numberEarly_(0)
+  , earlyStatus_(-1)
+  , earlyResult_(-1)
+  , numberEarlyPivots_(0)
+  , maximumEarlyPivots_(0)
+  , lastCyclePivots_(0)
+  , lazyDualsBase_(NULL)
+  , lazyDualsFraction_(0.1)
+  , lazyDuals_(0)
+  , lazyDualsCount_(-1)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
@@ -227,6 +243,18 @@ ClpSimplex::ClpSimplex(const ClpModel *rhs,
   , numberRefinements_(0)
   , pivotVariable_(NULL)
   , factorization_(NULL)
+  , earlyFactorization_(NULL)
+  , earlyPivots_(NULL)
+  , numberEarly_(0)
+  , earlyStatus_(-1)
+  , earlyResult_(-1)
+  , numberEarlyPivots_(0)
+  , maximumEarlyPivots_(0)
+  , lastCyclePivots_(0)
+  , lazyDualsBase_(NULL)
+  , lazyDualsFraction_(0.1)
+  , lazyDuals_(0)
+  , lazyDualsCount_(-1)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
@@ -383,6 +411,18 @@ ClpSimplex::ClpSimplex(const ClpSimplex *rhs,
   , numberRefinements_(0)
   , pivotVariable_(NULL)
   , factorization_(NULL)
+  , earlyFactorization_(NULL)
+  , earlyPivots_(NULL)
+  , numberEarly_(rhs->numberEarly_)
+  , earlyStatus_(-1)
+  , earlyResult_(-1)
+  , numberEarlyPivots_(0)
+  , maximumEarlyPivots_(0)
+  , lastCyclePivots_(0)
+  , lazyDualsBase_(NULL)
+  , lazyDualsFraction_(rhs->lazyDualsFraction_)
+  , lazyDuals_(rhs->lazyDuals_)
+  , lazyDualsCount_(-1)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
@@ -1374,15 +1414,44 @@ void ClpSimplex::computeDuals(double *givenDjs)
       value += rowObjectiveWork_[iRow];
       rowReducedCost_[iRow] = value;
     }
+    // dual_ is set so work vectors are free
+    arrayVector->clear();
+    previousVector->clear();
     // can use work if problem scaled (for better cache)
     ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(matrix_);
+    // see if only changes in duals need doing
+    bool lazy = lazyDuals_ && clpMatrix && !numberExtraRows_ && !givenDjs;
+    bool updated = lazy && lazyReducedCosts();
     double *saveRowScale = rowScale_;
     //double * saveColumnScale = columnScale_;
     if (scaledMatrix_) {
       rowScale_ = NULL;
       clpMatrix = scaledMatrix_;
     }
-    if (clpMatrix && (clpMatrix->flags() & 2) == 0) {
+    if (updated) {
+      // reduced costs done from changes in duals
+    } else if (lazy && (clpMatrix->flags() & 2) == 0) {
+      // do all columns so basic ones can be updated after leaving
+      ClpDisjointCopyN(objectiveWork_, numberColumns_, reducedCostWork_);
+      if (numberRows_ > 4000)
+        clpMatrix->transposeTimes(-1.0, dual_, reducedCostWork_,
+          rowScale_, columnScale_, work);
+      else
+        clpMatrix->transposeTimes(-1.0, dual_, reducedCostWork_,
+          rowScale_, columnScale_, NULL);
+      if (lazyDualsCount_ < 0) {
+        delete[] lazyDualsBase_;
+        lazyDualsBase_ = new double[numberRows_ + numberColumns_];
+      }
+      CoinMemcpyN(dual_, numberRows_, lazyDualsBase_);
+      double *base = lazyDualsBase_ + numberRows_;
+      for (int i = 0; i < numberColumns_; i++) {
+        base[i] = reducedCostWork_[i] - objectiveWork_[i];
+        if (getColumnStatus(i) == basic)
+          reducedCostWork_[i] = 0.0;
+      }
+      lazyDualsCount_ = 0;
+    } else if (clpMatrix && (clpMatrix->flags() & 2) == 0) {
       CoinIndexedVector *cVector = columnArray_[0];
       int *whichColumn = cVector->getIndices();
       assert(!cVector->getNumElements());
@@ -1421,8 +1490,6 @@ void ClpSimplex::computeDuals(double *givenDjs)
       // restore accurate duals
       CoinMemcpyN(dj_, (numberRows_ + numberColumns_), givenDjs);
     }
-    arrayVector->clear();
-    previousVector->clear();
 #ifndef SLIM_CLP
   } else {
     // Nonlinear
@@ -1432,6 +1499,164 @@ void ClpSimplex::computeDuals(double *givenDjs)
   }
 #endif
 }
+/* Updates reduced costs from changes in duals since last pass.
+   Only columns in rows whose duals changed go through matrix but
+   all nonbasic reduced costs are redone from current costs.
+   Returns false if full pass needed */
+bool ClpSimplex::lazyReducedCosts()
+{
+  if (lazyDualsCount_ < 0 || lazyDualsCount_ >= lazyDuals_ || !rowCopy_)
+    return false;
+  // dual_ is set so rowArray_[1] and rowArray_[2] are free
+  CoinIndexedVector *deltaVector = rowArray_[1];
+  assert(!deltaVector->getNumElements());
+  double *delta = deltaVector->denseVector();
+  int *index = deltaVector->getIndices();
+  double *savedDual = lazyDualsBase_;
+  // if too many changed then by column would be used anyway
+  int maximumChanged = static_cast< int >(lazyDualsFraction_ * numberRows_);
+  int number = 0;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    double value = dual_[iRow] - savedDual[iRow];
+    if (value) {
+      if (number == maximumChanged) {
+        deltaVector->setNumElements(number);
+        deltaVector->clear();
+        return false;
+      }
+      delta[iRow] = value;
+      index[number++] = iRow;
+    }
+  }
+  deltaVector->setNumElements(number);
+  double *base = lazyDualsBase_ + numberRows_;
+  if (number) {
+    CoinIndexedVector *columnArray = columnArray_[0];
+    assert(!columnArray->getNumElements());
+    matrix_->transposeTimes(this, -1.0, deltaVector,
+#ifdef LONG_REGION_2
+      rowArray_[2],
+#else
+      columnArray_[1],
+#endif
+      columnArray);
+    int numberChanged = columnArray->getNumElements();
+    const int *which = columnArray->getIndices();
+    const double *element = columnArray->denseVector();
+    bool packed = columnArray->packedMode();
+    // move base to current duals
+    if (packed) {
+      for (int i = 0; i < numberChanged; i++)
+        base[which[i]] += element[i];
+    } else {
+      for (int i = 0; i < numberChanged; i++)
+        base[which[i]] += element[which[i]];
+    }
+    columnArray->clear();
+    deltaVector->clear();
+    CoinMemcpyN(dual_, numberRows_, savedDual);
+  }
+  // costs may have changed (perturbation, bounds) so redo all columns
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (getColumnStatus(iColumn) != basic)
+      reducedCostWork_[iColumn] = objectiveWork_[iColumn] + base[iColumn];
+    else
+      reducedCostWork_[iColumn] = 0.0;
+  }
+  lazyDualsCount_++;
+  return true;
+}
+// Approximate bytes used by a matrix
+static double matrixBytes(const ClpMatrixBase *matrix)
+{
+  if (!matrix)
+    return 0.0;
+  const ClpPackedMatrix *clpMatrix = dynamic_cast< const ClpPackedMatrix * >(matrix);
+  if (clpMatrix) {
+    double bytes[4];
+    clpMatrix->memoryUsage(bytes);
+    return bytes[0] + bytes[1] + bytes[2] + bytes[3];
+  } else {
+    return static_cast< double >(matrix->getNumElements()) * (sizeof(double) + sizeof(int));
+  }
+}
+/* Prints approximate memory used by each component of model
+   (using handler) and returns total in bytes */
+double ClpSimplex::memoryReport()
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  const char *name[] = { "matrix", "special matrix copies", "row copy",
+    "scaled matrix", "model arrays", "working arrays", "scale factors",
+    "saved solution", "work vectors", "factorization", "other" };
+  double bytes[11];
+  CoinZeroN(bytes, 11);
+  ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(matrix_);
+  if (clpMatrix) {
+    double packedBytes[4];
+    clpMatrix->memoryUsage(packedBytes);
+    bytes[0] = packedBytes[0];
+    bytes[1] = packedBytes[1] + packedBytes[2] + packedBytes[3];
+  } else {
+    bytes[0] = matrixBytes(matrix_);
+  }
+  bytes[2] = matrixBytes(rowCopy_);
+  bytes[3] = matrixBytes(scaledMatrix_);
+  // bounds, costs and solution in model
+  bytes[4] = static_cast< double >(numberTotal) * (4 * sizeof(double) + 1)
+    + static_cast< double >(numberColumns_) * sizeof(double);
+  if (solution_)
+    bytes[5] += static_cast< double >(numberTotal) * sizeof(double);
+  if (lower_)
+    bytes[5] += static_cast< double >(numberTotal) * sizeof(double);
+  if (upper_)
+    bytes[5] += static_cast< double >(numberTotal) * sizeof(double);
+  if (dj_)
+    bytes[5] += static_cast< double >(numberTotal) * sizeof(double);
+  if (cost_)
+    bytes[5] += static_cast< double >(2 * numberTotal) * sizeof(double);
+  if (pivotVariable_)
+    bytes[5] += static_cast< double >(numberRows_) * sizeof(int);
+  if (savedRowScale_) {
+    bytes[6] = static_cast< double >(4 * (maximumRows_ + maximumColumns_)) * sizeof(double);
+  } else if (rowScale_) {
+    bytes[6] = static_cast< double >(2 * numberTotal) * sizeof(double);
+  }
+  if (savedSolution_)
+    bytes[7] += static_cast< double >(numberTotal) * sizeof(double);
+  if (saveStatus_)
+    bytes[7] += numberTotal;
+  for (int i = 0; i < 6; i++) {
+    if (rowArray_[i])
+      bytes[8] += static_cast< double >(rowArray_[i]->capacity()) * (sizeof(double) + sizeof(int));
+    if (columnArray_[i])
+      bytes[8] += static_cast< double >(columnArray_[i]->capacity()) * (sizeof(double) + sizeof(int));
+  }
+  if (factorization_)
+    bytes[9] = static_cast< double >(factorization_->numberElements()) * (sizeof(double) + sizeof(int));
+  if (earlyFactorization_)
+    bytes[9] += static_cast< double >(earlyFactorization_->numberElements()) * (sizeof(double) + sizeof(int));
+  if (lazyDualsBase_)
+    bytes[10] += static_cast< double >(numberTotal) * sizeof(double);
+  if (nonLinearCost_)
+    bytes[10] += static_cast< double >(numberTotal) * (4 * sizeof(double) + 1);
+  double total = 0.0;
+  char line[100];
+  for (int i = 0; i < 11; i++) {
+    total += bytes[i];
+    if (bytes[i]) {
+      sprintf(line, "Memory for %s %.2f MB", name[i], bytes[i] * (1.0 / 1048576.0));
+      handler_->message(CLP_GENERAL, messages_)
+        << line
+        << CoinMessageEol;
+    }
+  }
+  sprintf(line, "Total memory %.2f MB (%.2f times matrix)", total * (1.0 / 1048576.0),
+    bytes[0] ? total / bytes[0] : 0.0);
+  handler_->message(CLP_GENERAL, messages_)
+    << line
+    << CoinMessageEol;
+  return total;
+}
 /* Given an existing factorization computes and checks
    primal and dual solutions.  Uses input arrays for variables at
    bounds.  Returns feasibility states */
@@ -2011,6 +2236,15 @@ int ClpSimplex::internalFactorize(int solveType)
 	   numberOutside,sumOutside,numberOutsideLarge,
 	   numberInside,sumInside,numberInsideLarge);
 #endif
+  int numberPivots = factorization_->pivots();
+  if (numberPivots)
+    lastCyclePivots_ = numberPivots;
+  if (earlyStatus_ >= 0) {
+    // only if cycle ended normally - not if refactorizing for accuracy
+    if (earlyStatus_ == 2 && solveType == 1 && !valuesPass && useEarlyFactorization())
+      return 0;
+    earlyStatus_ = -1;
+  }
   int status = factorization_->factorize(this, solveType, valuesPass);
   if (status) {
     handler_->message(CLP_SIMPLEX_BADFACTOR, messages_)
@@ -2045,6 +2279,113 @@ int ClpSimplex::internalFactorize(int solveType)
 
   return status;
 }
+/* Returns true if early factorization should be started now -
+   if so basis has been saved and doEarlyFactorization should be
+   spawned (synchronized before next internalFactorize) */
+bool ClpSimplex::startEarlyFactorization()
+{
+#if ABOCA_LITE
+  if (!numberEarly_ || earlyStatus_ >= 0 || !abcState())
+    return false;
+  // not with persistent factorization as that may be swapped
+  if ((specialOptions_ & 65536) != 0 || factorization_->isDenseOrSmall()
+    || matrix_->type() != 1 || objective_->type() > 1)
+    return false;
+  int maximumPivots = factorization_->maximumPivots();
+  int cycle = lastCyclePivots_ ? CoinMin(lastCyclePivots_, maximumPivots) : maximumPivots;
+  // not worth it on short cycles
+  if (cycle < 2 * numberEarly_ || factorization_->pivots() != cycle - numberEarly_)
+    return false;
+  if (!earlyFactorization_ || earlyFactorization_->isDenseOrSmall()) {
+    delete earlyFactorization_;
+    earlyFactorization_ = new ClpFactorization(*factorization_);
+  } else {
+    earlyFactorization_->maximumPivots(maximumPivots);
+    earlyFactorization_->pivotTolerance(factorization_->pivotTolerance());
+    earlyFactorization_->zeroTolerance(factorization_->zeroTolerance());
+  }
+  // room for basis and pivots (in, out) until end of any cycle
+  int numberNeeded = numberRows_ + 2 * maximumPivots;
+  if (numberNeeded > numberRows_ + 2 * maximumEarlyPivots_ || !earlyPivots_) {
+    delete[] earlyPivots_;
+    earlyPivots_ = new int[numberNeeded];
+  }
+  maximumEarlyPivots_ = maximumPivots;
+  CoinMemcpyN(pivotVariable_, numberRows_, earlyPivots_);
+  numberEarlyPivots_ = 0;
+  earlyResult_ = -1;
+  earlyStatus_ = 0;
+  return true;
+#else
+  return false;
+#endif
+}
+// Factorizes saved basis - may run on another thread
+void ClpSimplex::doEarlyFactorization()
+{
+  earlyResult_ = earlyFactorization_->factorizeBasis(this, earlyPivots_);
+}
+/* Replays saved pivots on early factorization and if all okay
+   and basis matches makes it current.  Returns true if used */
+bool ClpSimplex::useEarlyFactorization()
+{
+  bool okay = earlyStatus_ == 2 && !earlyResult_;
+  earlyStatus_ = -1;
+  if (!okay)
+    return false;
+  int *pivotEarly = earlyPivots_;
+  const int *savedPivots = earlyPivots_ + numberRows_;
+  CoinIndexedVector *region = rowArray_[2];
+  CoinIndexedVector *column = rowArray_[1];
+  if (region->getNumElements() || column->getNumElements())
+    return false;
+  // sparse methods as in internalFactorize
+  earlyFactorization_->sparseThreshold(0);
+  if (!(moreSpecialOptions_ & 1024))
+    earlyFactorization_->goSparse();
+  // replaceColumn may look at these
+  int saveIn = sequenceIn_;
+  int saveOut = sequenceOut_;
+  double saveAlpha = alpha_;
+  for (int iPivot = 0; iPivot < numberEarlyPivots_; iPivot++) {
+    sequenceIn_ = savedPivots[2 * iPivot];
+    sequenceOut_ = savedPivots[2 * iPivot + 1];
+    int iRow;
+    for (iRow = 0; iRow < numberRows_; iRow++) {
+      if (pivotEarly[iRow] == sequenceOut_)
+        break;
+    }
+    if (iRow == numberRows_) {
+      okay = false;
+      break;
+    }
+    unpack(column, sequenceIn_);
+    earlyFactorization_->updateColumnFT(region, column);
+    alpha_ = column->denseVector()[iRow];
+    if (fabs(alpha_) < 1.0e-8 || earlyFactorization_->replaceColumn(this, region, column, iRow, alpha_))
+      okay = false;
+    region->clear();
+    column->clear();
+    if (!okay)
+      break;
+    pivotEarly[iRow] = sequenceIn_;
+  }
+  sequenceIn_ = saveIn;
+  sequenceOut_ = saveOut;
+  alpha_ = saveAlpha;
+  // basis may have been changed other than by pivots
+  for (int iRow = 0; iRow < numberRows_ && okay; iRow++) {
+    if (getStatus(pivotEarly[iRow]) != basic)
+      okay = false;
+  }
+  if (okay) {
+    ClpFactorization *temp = factorization_;
+    factorization_ = earlyFactorization_;
+    earlyFactorization_ = temp;
+    CoinMemcpyN(pivotEarly, numberRows_, pivotVariable_);
+  }
+  return okay;
+}
 /*
    This does basis housekeeping and does values for in/out variables.
    Can also decide to re-factorize
@@ -2095,6 +2436,17 @@ int ClpSimplex::housekeeping(double objectiveChange)
     }
     //assert( getStatus(sequenceOut_)== basic);
     setStatus(sequenceIn_, basic);
+    if (!earlyStatus_) {
+      // save for replay on early factorization
+      if (numberEarlyPivots_ < maximumEarlyPivots_) {
+        int *savedPivots = earlyPivots_ + numberRows_ + 2 * numberEarlyPivots_;
+        savedPivots[0] = sequenceIn_;
+        savedPivots[1] = sequenceOut_;
+        numberEarlyPivots_++;
+      } else {
+        earlyStatus_ = 1;
+      }
+    }
     if (upper_[sequenceOut_] - lower_[sequenceOut_] > 0) {
       // As Nonlinear costs may have moved bounds (to more feasible)
       // Redo using value
@@ -2348,6 +2700,9 @@ int ClpSimplex::housekeeping(double objectiveChange)
 #if CLP_FACTORIZATION_NEW_TIMING > 1
     factorization_->statsRefactor('M');
 #endif
+    // normal end of cycle - early factorization may be used
+    if (!earlyStatus_)
+      earlyStatus_ = 2;
     return 1;
   } else if ((factorization_->timeToRefactorize() && !dontInvert)
     || invertNow) {
@@ -2355,6 +2710,8 @@ int ClpSimplex::housekeeping(double objectiveChange)
 #if CLP_FACTORIZATION_NEW_TIMING > 1
     factorization_->statsRefactor('T');
 #endif
+    if (!earlyStatus_ && !invertNow)
+      earlyStatus_ = 2;
     return 1;
   } else if (forceFactorization_ > 0 && factorization_->pivots() == forceFactorization_) {
     // relax
@@ -2445,6 +2802,18 @@ ClpSimplex::ClpSimplex(const ClpSimplex &rhs, int scalingMode)
   , numberRefinements_(0)
   , pivotVariable_(NULL)
   , factorization_(NULL)
+  , earlyFactorization_(NULL)
+  , earlyPivots_(NULL)
+  , numberEarly_(0)
+  , earlyStatus_(-1)
+  , earlyResult_(-1)
+  , numberEarlyPivots_(0)
+  , maximumEarlyPivots_(0)
+  , lastCyclePivots_(0)
+  , lazyDualsBase_(NULL)
+  , lazyDualsFraction_(0.1)
+  , lazyDuals_(0)
+  , lazyDualsCount_(-1)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
@@ -2554,6 +2923,18 @@ ClpSimplex::ClpSimplex(const ClpModel &rhs, int scalingMode)
   , numberRefinements_(0)
   , pivotVariable_(NULL)
   , factorization_(NULL)
+  , earlyFactorization_(NULL)
+  , earlyPivots_(NULL)
+  , numberEarly_(0)
+  , earlyStatus_(-1)
+  , earlyResult_(-1)
+  , numberEarlyPivots_(0)
+  , maximumEarlyPivots_(0)
+  , lastCyclePivots_(0)
+  , lazyDualsBase_(NULL)
+  , lazyDualsFraction_(0.1)
+  , lazyDuals_(0)
+  , lazyDualsCount_(-1)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
@@ -2698,6 +3079,16 @@ void ClpSimplex::gutsOfCopy(const ClpSimplex &rhs)
     delete factorization_;
     factorization_ = NULL;
   }
+  // early factorization is not copied
+  numberEarly_ = rhs.numberEarly_;
+  earlyStatus_ = -1;
+  earlyResult_ = -1;
+  numberEarlyPivots_ = 0;
+  maximumEarlyPivots_ = 0;
+  lastCyclePivots_ = 0;
+  lazyDualsFraction_ = rhs.lazyDualsFraction_;
+  lazyDuals_ = rhs.lazyDuals_;
+  lazyDualsCount_ = -1;
   bestPossibleImprovement_ = rhs.bestPossibleImprovement_;
   columnPrimalSequence_ = rhs.columnPrimalSequence_;
   zeroTolerance_ = rhs.zeroTolerance_;
@@ -2833,6 +3224,14 @@ void ClpSimplex::gutsOfDelete(int type)
   }
   delete[] saveStatus_;
   saveStatus_ = NULL;
+  delete earlyFactorization_;
+  earlyFactorization_ = NULL;
+  delete[] earlyPivots_;
+  earlyPivots_ = NULL;
+  earlyStatus_ = -1;
+  delete[] lazyDualsBase_;
+  lazyDualsBase_ = NULL;
+  lazyDualsCount_ = -1;
   if (type != 1) {
     delete rowCopy_;
     rowCopy_ = NULL;
@@ -3387,6 +3786,8 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
   bool goodMatrix = true;
   int saveLevel = handler_->logLevel();
   spareIntArray_[0] = 0;
+  // matrix or scaling may change so need full pass of computeDuals
+  lazyDualsCount_ = -1;
   if (!matrix_->canGetRowCopy())
     makeRowCopy = false; // switch off row copy if can't produce
   // Arrays will be there and correct size unless what is 63
@@ -3510,6 +3911,13 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
     // We may want to switch stuff off for speed
     if ((specialOptions_ & 256) != 0)
       makeRowCopy = false; // no row copy
+    bool leanMemory = (moreSpecialOptions_ & 536870912) != 0;
+    if (leanMemory && algorithm_ > 0) {
+      // primal can price by column so save space of row copy
+      makeRowCopy = false;
+      delete rowCopy_;
+      rowCopy_ = NULL;
+    }
     if ((specialOptions_ & 128) != 0)
       doSanityCheck = false; // no sanity check
     //check matrix
@@ -3712,8 +4120,8 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
       inverseRowScale_ = rowScale_ + numberRows2;
       inverseColumnScale_ = columnScale_ + numberColumns_;
     }
-    // See if we can try for faster row copy
-    if (makeRowCopy && !oldMatrix) {
+    // See if we can try for faster row copy (not if short of memory)
+    if (makeRowCopy && !oldMatrix && !leanMemory) {
       ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(matrix_);
       if (clpMatrix && numberThreads_)
         clpMatrix->specialRowCopy(this, rowCopy_);
@@ -6396,6 +6804,14 @@ int ClpSimplex::reducedGradient(int phase)
    Does crossover to simplex if asked*/
 int ClpSimplex::barrier(bool crossover)
 {
+  if (objective_->type() > 2) {
+    // barrier only knows linear and quadratic objectives
+    handler_->message(CLP_GENERAL, messages_)
+      << "Barrier can not handle this nonlinear objective - use primal"
+      << CoinMessageEol;
+    problemStatus_ = 4;
+    return problemStatus_;
+  }
   ClpSimplex *model2 = this;
   int savePerturbation = perturbation_;
   ClpInterior barrier;
@@ -9256,6 +9672,8 @@ int ClpSimplex::startup(int ifValuesPass, int startFinishOptions)
   // put in standard form (and make row copy)
   // create modifiable copies of model rim and do optional scaling
   bool goodMatrix = createRim(7 + 8 + 16 + 32, true, startFinishOptions);
+  if (goodMatrix && (moreSpecialOptions_ & 536870912) != 0 && handler_->logLevel() > 1)
+    memoryReport();
 
   if (goodMatrix) {
     // switch off factorization if bad
@@ -873,6 +873,46 @@ public:
          Special case is numberRows_+1 -> all slack basis.
      */
   int internalFactorize(int solveType);
+  /** Early factorization - if numberEarly > 0 then when that many
+      pivots are left in a refactorization cycle (as long as last one)
+      the current basis is factorized by a helper task (only with
+      ABOCA_LITE and threads) while iterations carry on.  When
+      refactorization is due the pivots done since are replayed on it
+      instead of factorizing from scratch.  0 (default) switches off */
+  inline void setEarlyFactorization(int numberEarly)
+  {
+    numberEarly_ = CoinMax(numberEarly, 0);
+  }
+  inline int earlyFactorization() const
+  {
+    return numberEarly_;
+  }
+  /** Returns true if early factorization should be started now -
+      if so basis has been saved and doEarlyFactorization should be
+      spawned (synchronized before next internalFactorize) */
+  bool startEarlyFactorization();
+  /// Factorizes saved basis - may run on another thread
+  void doEarlyFactorization();
+  /** Lazy reduced costs - if numberLazy > 0 then computeDuals
+      only multiplies changes in duals since last pass (using
+      row copy) so only columns in those rows are touched.  A full
+      pass is done after numberLazy such updates or if more than
+      fraction of rows have changed duals.  0 (default) switches off */
+  inline void setLazyDuals(int numberLazy, double fraction = 0.1)
+  {
+    lazyDuals_ = CoinMax(numberLazy, 0);
+    lazyDualsFraction_ = fraction;
+    lazyDualsCount_ = -1;
+  }
+  inline int lazyDuals() const
+  {
+    return lazyDuals_;
+  }
+  /** Prints approximate memory used by each component of model
+      (matrix and copies, rim arrays, work vectors, factorization)
+      and returns total in bytes.  Done at startup if lean memory
+      (536870912 bit of moreSpecialOptions) and log level > 1 */
+  double memoryReport();
   /// Save data
   ClpDataSave saveData();
   /// Restore data
@@ -931,6 +971,13 @@ protected:
          Can also decide to re-factorize
      */
   int housekeeping(double objectiveChange);
+  /** Replays saved pivots on early factorization and if all okay
+      and basis matches makes it current.  Returns true if used */
+  bool useEarlyFactorization();
+  /** Updates reduced costs from changes in duals since last pass -
+      only columns touched by changes go through matrix.
+      Returns false if full pass needed */
+  bool lazyReducedCosts();
   /** This sets largest infeasibility and most infeasible and sum
          and number of infeasibilities (Primal) */
   void checkPrimalSolution(const double *rowActivities = NULL,
@@ -1437,6 +1484,8 @@ public:
 	 67108864 bit - try sorted values pass
 	 134217728 bit - clean up problem if scaling feasible mismatch
 	 268435456 bit - objective is piecewise linear
+	 536870912 bit - lean memory (no scaled or special matrix copies,
+	                 no row copy in primal)
   */
   inline int moreSpecialOptions() const
   {
@@ -1476,6 +1525,8 @@ public:
 	 67108864 bit - try sorted values pass
 	 134217728 bit - clean up problem if scaling feasible mismatch
 	 268435456 bit - objective is piecewise linear
+	 536870912 bit - lean memory (no scaled or special matrix copies,
+	                 no row copy in primal)
      */
   inline void setMoreSpecialOptions(int value)
   {
@@ -1901,6 +1952,33 @@ protected:
   int *pivotVariable_;
   /// factorization
   ClpFactorization *factorization_;
+  /// Early factorization (or spare one after it was used)
+  ClpFactorization *earlyFactorization_;
+  /** Basis for early factorization (then its pivot order)
+      followed by pivots (in, out) done since */
+  int *earlyPivots_;
+  /// Pivots left in cycle when early factorization started (0 off)
+  int numberEarly_;
+  /** -1 none, 0 started and pivots being saved, 1 abandoned,
+      2 cycle ended normally (so early factorization may be used) */
+  int earlyStatus_;
+  /// Result of early factorization (only look after synchronizing)
+  int earlyResult_;
+  /// Number of pivots saved since early factorization started
+  int numberEarlyPivots_;
+  /// Room for saved pivots
+  int maximumEarlyPivots_;
+  /// Pivots in last refactorization cycle
+  int lastCyclePivots_;
+  /** Duals at last pass of computeDuals followed by
+      minus column times those duals (for lazy reduced costs) */
+  double *lazyDualsBase_;
+  /// Fraction of rows whose duals may change for lazy reduced costs
+  double lazyDualsFraction_;
+  /// Updates allowed between full passes of computeDuals (0 off)
+  int lazyDuals_;
+  /// Updates since last full pass (-1 no valid full pass)
+  int lazyDualsCount_;
   /// Saved version of solution
   double *savedSolution_;
   /// Number of times code has tentatively thought optimal
@@ -1670,6 +1670,11 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
         }
         solution_[sequenceOut_] = valueOut_;
         int whatNext = housekeeping(objectiveChange);
+#if ABOCA_LITE
+        // maybe factorize current basis while iterating (synchronized on return)
+        if (startEarlyFactorization())
+          cilk_spawn doEarlyFactorization();
+#endif
 #if 0
 		    for (int i=0;i<numberRows_+numberColumns_;i++) {
 		      if (getStatus(i)==atLowerBound) {
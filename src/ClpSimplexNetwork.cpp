@@ -0,0 +1,656 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+/* Notes on implementation of network simplex algorithm.
+
+   Nodes are the rows plus a root (numberRows_).  Arcs are the columns,
+   then one arc per row (node to root - its flow is the row activity) and
+   then one artificial arc per node (either direction, only used to get
+   a starting spanning tree).  So every node balance is zero.
+
+   The tree is held as parent, predecessor arc, depth and thread.  The
+   thread is a preorder so the subtree of a node is the node followed by
+   all nodes on the thread with greater depth.  On a pivot the subtree
+   hanging from the leaving arc is re-rooted at the entering arc and
+   spliced back in after its new parent.
+*/
+
+#include "CoinPragma.hpp"
+
+#include <math.h>
+
+#include "CoinHelperFunctions.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
+#include "ClpSimplexNetwork.hpp"
+#include "ClpNetworkMatrix.hpp"
+#include "ClpObjective.hpp"
+#include "ClpMessage.hpp"
+#include "CoinTime.hpp"
+#include <cfloat>
+#include <cassert>
+#include <stdio.h>
+
+// arc states
+#define NETWORK_BASIC 0
+#define NETWORK_LOWER 1
+#define NETWORK_UPPER 2
+#define NETWORK_FREE 3
+#define NETWORK_FIXED 4
+
+typedef struct {
+  int *from;
+  int *to;
+  double *cost;
+  double *lower;
+  double *upper;
+  double *flow;
+  unsigned char *state;
+  int *parent;
+  int *predArc;
+  int *depth;
+  int *thread;
+  int *revThread;
+  double *pi;
+  int *order;
+  int numberArcs;
+  int root;
+} clpNetworkTree;
+
+/* Scans a block of arcs (wrapping round) for best violated
+   reduced cost.  Arc in numberAdded (-1 if none) and violation
+   in bestPossible */
+static void
+networkPriceBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT cost = info.cost;
+  const double *COIN_RESTRICT pi = info.work;
+  const unsigned char *COIN_RESTRICT state = info.status;
+  const int *COIN_RESTRICT from = info.which;
+  const int *COIN_RESTRICT to = info.index;
+  int numberArcs = info.numberColumns;
+  int iArc = info.startColumn;
+  double best = -info.dualTolerance;
+  int bestArc = -1;
+  for (int i = 0; i < info.numberToDo; i++) {
+    double dj = cost[iArc] + pi[from[iArc]] - pi[to[iArc]];
+    double violation;
+    switch (state[iArc]) {
+    case NETWORK_LOWER:
+      violation = dj;
+      break;
+    case NETWORK_UPPER:
+      violation = -dj;
+      break;
+    case NETWORK_FREE:
+      violation = -fabs(dj);
+      break;
+    default:
+      violation = 0.0;
+      break;
+    }
+    if (violation < best) {
+      best = violation;
+      bestArc = iArc;
+    }
+    iArc++;
+    if (iArc == numberArcs)
+      iArc = 0;
+  }
+  info.bestPossible = best;
+  info.numberAdded = bestArc;
+}
+/* Block search pricing starting at nextArc.
+   Returns entering arc or -1 if optimal */
+static int
+networkPrice(clpTempInfo *info, int numberThreads, int numberArcs,
+  int blockSize, int &nextArc)
+{
+  int numberScanned = 0;
+  while (numberScanned < numberArcs) {
+    int numberToDo = CoinMin(blockSize, numberArcs - numberScanned);
+    double best = 0.0;
+    int bestArc = -1;
+#if ABOCA_LITE
+    if (numberThreads > 1 && numberToDo >= 1000 * numberThreads) {
+      int chunk = (numberToDo + numberThreads - 1) / numberThreads;
+      int start = nextArc;
+      int n = 0;
+      for (int i = 0; i < numberThreads; i++) {
+        info[i].startColumn = start;
+        info[i].numberToDo = CoinMax(CoinMin(chunk, numberToDo - n), 0);
+        n += chunk;
+        start += chunk;
+        if (start >= numberArcs)
+          start -= numberArcs;
+      }
+      for (int i = 0; i < numberThreads; i++)
+        cilk_spawn networkPriceBit(info[i]);
+      cilk_sync;
+      for (int i = 0; i < numberThreads; i++) {
+        if (info[i].numberAdded >= 0 && info[i].bestPossible < best) {
+          best = info[i].bestPossible;
+          bestArc = info[i].numberAdded;
+        }
+      }
+    } else {
+#endif
+      info[0].startColumn = nextArc;
+      info[0].numberToDo = numberToDo;
+      networkPriceBit(info[0]);
+      bestArc = info[0].numberAdded;
+#if ABOCA_LITE
+    }
+#endif
+    nextArc += numberToDo;
+    if (nextArc >= numberArcs)
+      nextArc -= numberArcs;
+    numberScanned += numberToDo;
+    if (bestArc >= 0)
+      return bestArc;
+  }
+  return -1;
+}
+// Recomputes depth and potentials for all nodes (along thread)
+static void
+networkPotentials(clpNetworkTree &tree)
+{
+  int root = tree.root;
+  tree.depth[root] = 0;
+  tree.pi[root] = 0.0;
+  int iNode = tree.thread[root];
+  while (iNode != root) {
+    int iParent = tree.parent[iNode];
+    int iArc = tree.predArc[iNode];
+    tree.depth[iNode] = tree.depth[iParent] + 1;
+    if (tree.to[iArc] == iNode)
+      tree.pi[iNode] = tree.pi[iParent] + tree.cost[iArc];
+    else
+      tree.pi[iNode] = tree.pi[iParent] - tree.cost[iArc];
+    iNode = tree.thread[iNode];
+  }
+}
+/* Moves subtree hanging from uOut so it hangs from vIn
+   via inArc (uIn is in subtree) */
+static void
+networkUpdateTree(clpNetworkTree &tree, int inArc, int uIn, int vIn, int uOut)
+{
+  int *COIN_RESTRICT parent = tree.parent;
+  int *COIN_RESTRICT predArc = tree.predArc;
+  int *COIN_RESTRICT depth = tree.depth;
+  int *COIN_RESTRICT thread = tree.thread;
+  int *COIN_RESTRICT revThread = tree.revThread;
+  int *COIN_RESTRICT order = tree.order;
+  const int *COIN_RESTRICT to = tree.to;
+  const double *COIN_RESTRICT cost = tree.cost;
+  double *COIN_RESTRICT pi = tree.pi;
+  /* New preorder is old subtree of uIn, then parent of uIn and its
+     old subtree less what has been done and so on up to uOut */
+  int n = 0;
+  int previous = -1;
+  int previousLast = -1;
+  int iNode = uIn;
+  while (true) {
+    int iDepth = depth[iNode];
+    order[n++] = iNode;
+    int jNode = thread[iNode];
+    while (depth[jNode] > iDepth) {
+      if (jNode == previous) {
+        jNode = thread[previousLast];
+      } else {
+        order[n++] = jNode;
+        jNode = thread[jNode];
+      }
+    }
+    previous = iNode;
+    previousLast = revThread[jNode];
+    if (iNode == uOut)
+      break;
+    iNode = parent[iNode];
+  }
+  // take out old subtree
+  int before = revThread[uOut];
+  int after = thread[previousLast];
+  thread[before] = after;
+  revThread[after] = before;
+  // and put in after vIn
+  after = thread[vIn];
+  int last = vIn;
+  for (int i = 0; i < n; i++) {
+    thread[last] = order[i];
+    revThread[order[i]] = last;
+    last = order[i];
+  }
+  thread[last] = after;
+  revThread[after] = last;
+  // reverse path
+  int newParent = vIn;
+  int newPred = inArc;
+  iNode = uIn;
+  while (true) {
+    int oldParent = parent[iNode];
+    int oldPred = predArc[iNode];
+    parent[iNode] = newParent;
+    predArc[iNode] = newPred;
+    if (iNode == uOut)
+      break;
+    newParent = iNode;
+    newPred = oldPred;
+    iNode = oldParent;
+  }
+  // depths and potentials for moved nodes
+  for (int i = 0; i < n; i++) {
+    iNode = order[i];
+    int iParent = parent[iNode];
+    int iArc = predArc[iNode];
+    depth[iNode] = depth[iParent] + 1;
+    if (to[iArc] == iNode)
+      pi[iNode] = pi[iParent] + cost[iArc];
+    else
+      pi[iNode] = pi[iParent] - cost[iArc];
+  }
+}
+/* Does one pivot with entering arc (direction +1 to increase flow).
+   Returns 0 normal, 1 bound flip, 2 unbounded */
+static int
+networkPivot(clpNetworkTree &tree, int inArc, int direction)
+{
+  const int *COIN_RESTRICT from = tree.from;
+  const int *COIN_RESTRICT to = tree.to;
+  const double *COIN_RESTRICT lower = tree.lower;
+  const double *COIN_RESTRICT upper = tree.upper;
+  double *COIN_RESTRICT flow = tree.flow;
+  unsigned char *COIN_RESTRICT state = tree.state;
+  const int *COIN_RESTRICT parent = tree.parent;
+  const int *COIN_RESTRICT predArc = tree.predArc;
+  const int *COIN_RESTRICT depth = tree.depth;
+  // flow goes first->second along inArc and back through tree
+  int first = (direction > 0) ? from[inArc] : to[inArc];
+  int second = (direction > 0) ? to[inArc] : from[inArc];
+  int join1 = first;
+  int join2 = second;
+  while (join1 != join2) {
+    if (depth[join1] > depth[join2]) {
+      join1 = parent[join1];
+    } else if (depth[join2] > depth[join1]) {
+      join2 = parent[join2];
+    } else {
+      join1 = parent[join1];
+      join2 = parent[join2];
+    }
+  }
+  int join = join1;
+  double delta = COIN_DBL_MAX;
+  if (upper[inArc] < COIN_DBL_MAX && lower[inArc] > -COIN_DBL_MAX)
+    delta = upper[inArc] - lower[inArc];
+  int result = 0;
+  int uOut = -1;
+  int iNode;
+  // down from join to first (strict so last in cycle order)
+  for (iNode = first; iNode != join; iNode = parent[iNode]) {
+    int iArc = predArc[iNode];
+    double away;
+    if (to[iArc] == iNode)
+      away = (upper[iArc] < COIN_DBL_MAX) ? upper[iArc] - flow[iArc] : COIN_DBL_MAX;
+    else
+      away = (lower[iArc] > -COIN_DBL_MAX) ? flow[iArc] - lower[iArc] : COIN_DBL_MAX;
+    if (away < delta) {
+      delta = away;
+      uOut = iNode;
+      result = 1;
+    }
+  }
+  // up from second to join
+  for (iNode = second; iNode != join; iNode = parent[iNode]) {
+    int iArc = predArc[iNode];
+    double away;
+    if (from[iArc] == iNode)
+      away = (upper[iArc] < COIN_DBL_MAX) ? upper[iArc] - flow[iArc] : COIN_DBL_MAX;
+    else
+      away = (lower[iArc] > -COIN_DBL_MAX) ? flow[iArc] - lower[iArc] : COIN_DBL_MAX;
+    if (away <= delta) {
+      delta = away;
+      uOut = iNode;
+      result = 2;
+    }
+  }
+  if (delta >= 1.0e30)
+    return 2;
+  if (delta < 0.0)
+    delta = 0.0;
+  if (delta) {
+    flow[inArc] += direction * delta;
+    for (iNode = first; iNode != join; iNode = parent[iNode]) {
+      int iArc = predArc[iNode];
+      flow[iArc] += (to[iArc] == iNode) ? delta : -delta;
+    }
+    for (iNode = second; iNode != join; iNode = parent[iNode]) {
+      int iArc = predArc[iNode];
+      flow[iArc] += (from[iArc] == iNode) ? delta : -delta;
+    }
+  }
+  if (!result) {
+    // just goes to other bound
+    if (direction > 0) {
+      flow[inArc] = upper[inArc];
+      state[inArc] = NETWORK_UPPER;
+    } else {
+      flow[inArc] = lower[inArc];
+      state[inArc] = NETWORK_LOWER;
+    }
+    return 1;
+  }
+  int outArc = predArc[uOut];
+  bool toUpper = (result == 1) ? (to[outArc] == uOut) : (from[outArc] == uOut);
+  if (lower[outArc] == upper[outArc]) {
+    flow[outArc] = lower[outArc];
+    state[outArc] = NETWORK_FIXED;
+  } else if (toUpper) {
+    flow[outArc] = upper[outArc];
+    state[outArc] = NETWORK_UPPER;
+  } else {
+    flow[outArc] = lower[outArc];
+    state[outArc] = NETWORK_LOWER;
+  }
+  state[inArc] = NETWORK_BASIC;
+  if (result == 1)
+    networkUpdateTree(tree, inArc, first, second, uOut);
+  else
+    networkUpdateTree(tree, inArc, second, first, uOut);
+  return 0;
+}
+// Network simplex
+int ClpSimplexNetwork::network()
+{
+  if (!matrix_ || matrix_->type() != 11 || objective_->type() > 1)
+    return -1;
+  const ClpNetworkMatrix *networkMatrix = static_cast< const ClpNetworkMatrix * >(matrix_);
+  const int *indices = networkMatrix->getIndices();
+  int numberNodes = numberRows_ + 1;
+  int root = numberRows_;
+  int numberArcs = numberColumns_ + 2 * numberRows_;
+  clpNetworkTree tree;
+  tree.from = new int[2 * numberArcs];
+  tree.to = tree.from + numberArcs;
+  tree.cost = new double[4 * numberArcs];
+  tree.lower = tree.cost + numberArcs;
+  tree.upper = tree.lower + numberArcs;
+  tree.flow = tree.upper + numberArcs;
+  tree.state = new unsigned char[numberArcs];
+  tree.parent = new int[6 * numberNodes];
+  tree.predArc = tree.parent + numberNodes;
+  tree.depth = tree.predArc + numberNodes;
+  tree.thread = tree.depth + numberNodes;
+  tree.revThread = tree.thread + numberNodes;
+  tree.order = tree.revThread + numberNodes;
+  tree.pi = new double[numberNodes];
+  tree.numberArcs = numberArcs;
+  tree.root = root;
+  int *COIN_RESTRICT from = tree.from;
+  int *COIN_RESTRICT to = tree.to;
+  double *COIN_RESTRICT cost = tree.cost;
+  double *COIN_RESTRICT lower = tree.lower;
+  double *COIN_RESTRICT upper = tree.upper;
+  double *COIN_RESTRICT flow = tree.flow;
+  unsigned char *COIN_RESTRICT state = tree.state;
+  const double *objective = this->objective();
+  double direction = optimizationDirection_;
+  int iArc;
+  int iRow;
+  // structural arcs
+  for (iArc = 0; iArc < numberColumns_; iArc++) {
+    int iFrom = indices[2 * iArc];
+    int iTo = indices[2 * iArc + 1];
+    from[iArc] = (iFrom >= 0) ? iFrom : root;
+    to[iArc] = (iTo >= 0) ? iTo : root;
+    cost[iArc] = 0.0;
+    double lo = columnLower_[iArc];
+    double up = columnUpper_[iArc];
+    lower[iArc] = (lo > -1.0e30) ? lo : -COIN_DBL_MAX;
+    upper[iArc] = (up < 1.0e30) ? up : COIN_DBL_MAX;
+    if (lower[iArc] == upper[iArc]) {
+      flow[iArc] = lower[iArc];
+      state[iArc] = NETWORK_FIXED;
+    } else if (lower[iArc] > -COIN_DBL_MAX) {
+      flow[iArc] = lower[iArc];
+      state[iArc] = NETWORK_LOWER;
+    } else if (upper[iArc] < COIN_DBL_MAX) {
+      flow[iArc] = upper[iArc];
+      state[iArc] = NETWORK_UPPER;
+    } else {
+      flow[iArc] = 0.0;
+      state[iArc] = NETWORK_FREE;
+    }
+  }
+  // net inflow at each node (in pi for now)
+  double *excess = tree.pi;
+  CoinZeroN(excess, numberNodes);
+  for (iArc = 0; iArc < numberColumns_; iArc++) {
+    double value = flow[iArc];
+    excess[from[iArc]] -= value;
+    excess[to[iArc]] += value;
+  }
+  // row arcs, artificials and star tree from root
+  int *COIN_RESTRICT parent = tree.parent;
+  int *COIN_RESTRICT predArc = tree.predArc;
+  int *COIN_RESTRICT thread = tree.thread;
+  int *COIN_RESTRICT revThread = tree.revThread;
+  parent[root] = -1;
+  predArc[root] = -1;
+  thread[root] = (numberRows_) ? 0 : root;
+  revThread[root] = (numberRows_) ? numberRows_ - 1 : root;
+  bool needPhase1 = false;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int rowArc = numberColumns_ + iRow;
+    int artificial = rowArc + numberRows_;
+    double lo = rowLower_[iRow];
+    double up = rowUpper_[iRow];
+    from[rowArc] = iRow;
+    to[rowArc] = root;
+    cost[rowArc] = 0.0;
+    lower[rowArc] = (lo > -1.0e30) ? lo : -COIN_DBL_MAX;
+    upper[rowArc] = (up < 1.0e30) ? up : COIN_DBL_MAX;
+    lower[artificial] = 0.0;
+    upper[artificial] = COIN_DBL_MAX;
+    parent[iRow] = root;
+    thread[iRow] = (iRow < numberRows_ - 1) ? iRow + 1 : root;
+    revThread[iRow] = (iRow) ? iRow - 1 : root;
+    double value = excess[iRow];
+    if (value > lower[rowArc] && value < upper[rowArc]) {
+      // slack basic
+      flow[rowArc] = value;
+      state[rowArc] = NETWORK_BASIC;
+      predArc[iRow] = rowArc;
+      from[artificial] = iRow;
+      to[artificial] = root;
+      flow[artificial] = 0.0;
+      state[artificial] = NETWORK_LOWER;
+    } else {
+      // slack at bound and artificial takes rest
+      if (value <= lower[rowArc]) {
+        flow[rowArc] = lower[rowArc];
+        state[rowArc] = NETWORK_LOWER;
+      } else {
+        flow[rowArc] = upper[rowArc];
+        state[rowArc] = NETWORK_UPPER;
+      }
+      if (lower[rowArc] == upper[rowArc])
+        state[rowArc] = NETWORK_FIXED;
+      value -= flow[rowArc];
+      if (value > 0.0) {
+        from[artificial] = iRow;
+        to[artificial] = root;
+        flow[artificial] = value;
+        needPhase1 = true;
+      } else {
+        // zero flow arcs point away from root
+        from[artificial] = root;
+        to[artificial] = iRow;
+        flow[artificial] = -value;
+        if (value)
+          needPhase1 = true;
+      }
+      state[artificial] = NETWORK_BASIC;
+      predArc[iRow] = artificial;
+    }
+  }
+  // threads for pricing
+  int numberThreads = 1;
+#if ABOCA_LITE
+  numberThreads = CoinMax(CoinMin(abcState(), ABOCA_LITE), 1);
+  clpTempInfo info[ABOCA_LITE];
+#else
+  clpTempInfo info[1];
+#endif
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].cost = cost;
+    info[i].work = tree.pi;
+    info[i].status = state;
+    info[i].which = from;
+    info[i].index = to;
+    info[i].numberColumns = numberArcs;
+    info[i].dualTolerance = dualTolerance_;
+  }
+  int blockSize = static_cast< int >(sqrt(static_cast< double >(numberArcs)));
+  blockSize = CoinMax(blockSize * numberThreads, 10);
+  int nextArc = 0;
+  numberIterations_ = 0;
+  problemStatus_ = -1;
+  secondaryStatus_ = 0;
+  int numberPhase1 = 0;
+  char line[100];
+  for (int phase = needPhase1 ? 0 : 1; phase < 2; phase++) {
+    if (phase == 0) {
+      // minimize artificials
+      for (iArc = numberColumns_ + numberRows_; iArc < numberArcs; iArc++)
+        cost[iArc] = 1.0;
+    } else {
+      numberPhase1 = numberIterations_;
+      double sumArtificials = 0.0;
+      int numberArtificials = 0;
+      for (iArc = numberColumns_ + numberRows_; iArc < numberArcs; iArc++) {
+        if (flow[iArc] > primalTolerance_) {
+          sumArtificials += flow[iArc];
+          numberArtificials++;
+        }
+      }
+      if (numberArtificials) {
+        numberPrimalInfeasibilities_ = numberArtificials;
+        sumPrimalInfeasibilities_ = sumArtificials;
+        problemStatus_ = 1;
+        break;
+      }
+      // artificials now stay at zero
+      for (iArc = numberColumns_ + numberRows_; iArc < numberArcs; iArc++) {
+        cost[iArc] = 0.0;
+        flow[iArc] = 0.0;
+        upper[iArc] = 0.0;
+        if (state[iArc] != NETWORK_BASIC)
+          state[iArc] = NETWORK_FIXED;
+      }
+      for (iArc = 0; iArc < numberColumns_; iArc++)
+        cost[iArc] = direction * objective[iArc];
+    }
+    networkPotentials(tree);
+    while (true) {
+      int inArc = networkPrice(info, numberThreads, numberArcs,
+        blockSize, nextArc);
+      if (inArc < 0)
+        break;
+      int way;
+      if (state[inArc] == NETWORK_LOWER) {
+        way = 1;
+      } else if (state[inArc] == NETWORK_UPPER) {
+        way = -1;
+      } else {
+        double dj = cost[inArc] + tree.pi[from[inArc]] - tree.pi[to[inArc]];
+        way = (dj < 0.0) ? 1 : -1;
+      }
+      int returnCode = networkPivot(tree, inArc, way);
+      numberIterations_++;
+      if (returnCode == 2) {
+        problemStatus_ = 2;
+        break;
+      }
+      if ((numberIterations_ % 1000) == 0) {
+        if (hitMaximumIterations()) {
+          problemStatus_ = 3;
+          break;
+        }
+        if (handler_->logLevel() > 2 && (numberIterations_ % 100000) == 0) {
+          sprintf(line, "Network simplex phase %d - %d iterations",
+            phase + 1, numberIterations_);
+          handler_->message(CLP_GENERAL2, messages_)
+            << line
+            << CoinMessageEol;
+        }
+      } else if (numberIterations_ >= intParam_[ClpMaxNumIteration]) {
+        problemStatus_ = 3;
+        break;
+      }
+    }
+    if (problemStatus_ >= 0)
+      break;
+  }
+  if (problemStatus_ < 0)
+    problemStatus_ = 0;
+  // back to ClpSimplex arrays
+  if (!status_)
+    createStatus();
+  const double *pi = tree.pi;
+  for (iArc = 0; iArc < numberColumns_; iArc++) {
+    columnActivity_[iArc] = flow[iArc];
+    reducedCost_[iArc] = direction * (cost[iArc] + pi[from[iArc]] - pi[to[iArc]]);
+    switch (state[iArc]) {
+    case NETWORK_BASIC:
+      setColumnStatus(iArc, basic);
+      break;
+    case NETWORK_UPPER:
+      setColumnStatus(iArc, atUpperBound);
+      break;
+    case NETWORK_FREE:
+      setColumnStatus(iArc, isFree);
+      break;
+    default:
+      setColumnStatus(iArc, atLowerBound);
+      break;
+    }
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int rowArc = numberColumns_ + iRow;
+    int artificial = rowArc + numberRows_;
+    rowActivity_[iRow] = flow[rowArc];
+    dual_[iRow] = direction * pi[iRow];
+    // artificial in tree joins same nodes as row arc
+    if (state[rowArc] == NETWORK_BASIC || state[artificial] == NETWORK_BASIC)
+      setRowStatus(iRow, basic);
+    else if (state[rowArc] == NETWORK_UPPER)
+      setRowStatus(iRow, atUpperBound);
+    else
+      setRowStatus(iRow, atLowerBound);
+  }
+  computeObjectiveValue(false);
+  delete[] tree.from;
+  delete[] tree.cost;
+  delete[] tree.state;
+  delete[] tree.parent;
+  delete[] tree.pi;
+  if (problemStatus_ == 3)
+    onStopped();
+  sprintf(line, "Network simplex took %d iterations (%d in phase 1)",
+    numberIterations_, numberPhase1);
+  handler_->message(CLP_GENERAL2, messages_)
+    << line
+    << CoinMessageEol;
+  if (handler_->detail(CLP_SIMPLEX_FINISHED, messages_) < 100) {
+    handler_->message(CLP_SIMPLEX_FINISHED + problemStatus_, messages_)
+      << objectiveValue()
+      << CoinMessageEol;
+  }
+  return problemStatus_;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
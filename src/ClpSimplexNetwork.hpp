@@ -0,0 +1,54 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpSimplexNetwork_H
+#define ClpSimplexNetwork_H
+
+#include "ClpSimplex.hpp"
+
+/** This solves pure network LPs using a primal network simplex method
+
+    It inherits from ClpSimplex.  It has no data of its own and
+    is never created - only cast from a ClpSimplex object at algorithm time.
+
+*/
+
+class CLPLIB_EXPORT ClpSimplexNetwork : public ClpSimplex {
+
+public:
+  /**@name Description of algorithm */
+  //@{
+  /** Network simplex
+
+         Method
+
+        Only for models whose matrix is a ClpNetworkMatrix and whose
+        objective is linear.  Each column is an arc from the row with
+        the -1 entry to the row with the +1 entry (or from/to a root node
+        if there is only one entry).  Each row is an arc from its node to
+        the root with bounds rowLower,rowUpper so all node balances are
+        zero.  An artificial arc per node allows a spanning tree to be
+        made from slacks and artificials.  Phase 1 drives the artificials
+        to zero and phase 2 optimizes the true costs.
+
+        The basis is kept as a spanning tree rooted at the root node using
+        parent, depth and thread (preorder) indices, so a pivot only
+        touches the cycle and the subtree which is moved.  Pricing is a
+        block search which, if threads are available, scans the block in
+        parallel.  Ties in the ratio test are broken to keep the tree
+        strongly feasible.
+
+        Any existing basis is ignored.  On exit solution, duals, reduced
+        costs and status arrays are as after ClpSimplex::primal.
+
+        Returns problem status - 0 optimal, 1 infeasible, 2 unbounded,
+        3 stopped on iterations or time and -1 if model is not suitable
+        (in which case nothing has been changed).
+     */
+  int network();
+  //@}
+};
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
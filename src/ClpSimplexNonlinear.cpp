@@ -53,7 +53,8 @@ int ClpSimplexNonlinear::primal()
 #endif
     // for moment only if no scaling
     // May be faster if switched off - but can't see why
-    if (!quadraticObj->fullMatrix() && (!rowScale_ && !scalingFlag_) && objectiveScale_ == 1.0) {
+    // unless asked to keep triangle (gradient etc work on either)
+    if (quadraticObj && !quadraticObj->fullMatrix() && !quadraticObj->keepTriangular() && (!rowScale_ && !scalingFlag_) && objectiveScale_ == 1.0) {
       saveObjective = objective_;
       objective_ = new ClpQuadraticObjective(*quadraticObj, 1);
     }
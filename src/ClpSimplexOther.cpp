@@ -7,6 +7,10 @@
 #include <math.h>
 
 #include "CoinHelperFunctions.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexDual.hpp"
 #include "ClpSimplexPrimal.hpp"
@@ -18,8 +22,10 @@
 #include "ClpDynamicMatrix.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinIndexedVector.hpp"
+#include "CoinFactorization.hpp"
 #include "CoinBuild.hpp"
 #include "CoinMpsIO.hpp"
+#include "CoinStructuredModel.hpp"
 #include "CoinFloatEqual.hpp"
 #include "ClpMessage.hpp"
 #include "CoinTime.hpp"
@@ -6195,6 +6201,629 @@ void ClpSimplexOther::cleanupAfterPostsolve()
   matrix_->transposeTimes(-1.0, dual_, reducedCost_);
   checkSolutionInternal();
 }
+// Root of row in union-find used by bulkCrossoverBasis
+static int crossoverRoot(int *parent, int iRow)
+{
+  while (parent[iRow] != iRow) {
+    parent[iRow] = parent[parent[iRow]];
+    iRow = parent[iRow];
+  }
+  return iRow;
+}
+/* Crossover - builds basis in one go rather than pivot by pivot.
+   Returns number of columns made basic or -1 if all slack used */
+int ClpSimplexOther::bulkCrossoverBasis(double tolerance)
+{
+  const CoinPackedMatrix *matrix = this->matrix();
+  const int *row = matrix->getIndices();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  int *parent = new int[3 * numberRows_ + 2 * numberColumns_];
+  int *blockOfRow = parent + numberRows_;
+  int *blockSize = blockOfRow + numberRows_;
+  int *which = blockSize + numberRows_;
+  int *columnBlock = which + numberColumns_;
+  double *sort = new double[numberColumns_];
+  int iRow;
+  int iColumn;
+  for (iRow = 0; iRow < numberRows_; iRow++)
+    parent[iRow] = iRow;
+  // Candidates - push the rest to bounds
+  int numberCandidates = 0;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    columnBlock[iColumn] = -1;
+    double value = columnActivity_[iColumn];
+    double lower = columnLower_[iColumn];
+    double upper = columnUpper_[iColumn];
+    double distance = CoinMin(upper - value, value - lower);
+    Status status = getColumnStatus(iColumn);
+    if (status == basic) {
+      distance = COIN_DBL_MAX;
+    } else if (distance <= tolerance) {
+      if (status == superBasic) {
+        if (lower == upper) {
+          setColumnStatus(iColumn, isFixed);
+          columnActivity_[iColumn] = lower;
+        } else if (value - lower <= upper - value) {
+          setColumnStatus(iColumn, atLowerBound);
+          columnActivity_[iColumn] = lower;
+        } else {
+          setColumnStatus(iColumn, atUpperBound);
+          columnActivity_[iColumn] = upper;
+        }
+      }
+      continue;
+    }
+    if (!columnLength[iColumn])
+      continue;
+    CoinBigIndex start = columnStart[iColumn];
+    CoinBigIndex end = start + columnLength[iColumn];
+    int root = crossoverRoot(parent, row[start]);
+    for (CoinBigIndex j = start + 1; j < end; j++) {
+      int jRoot = crossoverRoot(parent, row[j]);
+      if (jRoot != root)
+        parent[jRoot] = root;
+    }
+    sort[numberCandidates] = -distance;
+    which[numberCandidates++] = iColumn;
+  }
+  // Number blocks and count rows in each
+  int numberBlocks = 0;
+  for (iRow = 0; iRow < numberRows_; iRow++)
+    blockOfRow[iRow] = -1;
+  for (int i = 0; i < numberCandidates; i++) {
+    iColumn = which[i];
+    int root = crossoverRoot(parent, row[columnStart[iColumn]]);
+    if (blockOfRow[root] < 0) {
+      blockSize[numberBlocks] = 0;
+      blockOfRow[root] = numberBlocks++;
+    }
+    columnBlock[iColumn] = blockOfRow[root];
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int root = crossoverRoot(parent, iRow);
+    int iBlock = blockOfRow[root];
+    if (iBlock >= 0)
+      blockSize[iBlock]++;
+  }
+  // Furthest from bounds first - but no more than rows in block
+  CoinSort_2(sort, sort + numberCandidates, which);
+  int *columnIsBasic = new int[numberColumns_];
+  int *rowIsBasic = parent;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++)
+    columnIsBasic[iColumn] = -1;
+  int numberTried = 0;
+  for (int i = 0; i < numberCandidates; i++) {
+    iColumn = which[i];
+    int iBlock = columnBlock[iColumn];
+    if (blockSize[iBlock]) {
+      blockSize[iBlock]--;
+      columnIsBasic[iColumn] = numberTried++;
+    }
+  }
+  // Rows in no block keep their slacks
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int root = crossoverRoot(parent, iRow);
+    blockSize[iRow] = (blockOfRow[root] < 0) ? iRow : -1;
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++)
+    rowIsBasic[iRow] = blockSize[iRow];
+  delete[] sort;
+  // factorize
+  CoinFactorization factor;
+  factor.pivotTolerance(0.1);
+  factor.setDenseThreshold(0);
+  int status = -1;
+  double areaFactor = 1.0;
+  bool allSlack = false;
+  while (status) {
+    status = factor.factorize(*matrix, rowIsBasic, columnIsBasic, areaFactor);
+    if (status == -99) {
+      // put all slacks in
+      for (iRow = 0; iRow < numberRows_; iRow++)
+        rowIsBasic[iRow] = iRow;
+      for (iColumn = 0; iColumn < numberColumns_; iColumn++)
+        columnIsBasic[iColumn] = -1;
+      allSlack = true;
+      break;
+    } else if (status == -1) {
+      factor.pivotTolerance(0.99);
+      // put all slacks in
+      for (iRow = 0; iRow < numberRows_; iRow++)
+        rowIsBasic[iRow] = iRow;
+      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        int jRow = columnIsBasic[iColumn];
+        if (jRow >= 0)
+          rowIsBasic[jRow] = -1; // out
+      }
+    }
+  }
+  int numberBasic = 0;
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (columnIsBasic[iColumn] >= 0) {
+      setColumnStatus(iColumn, basic);
+      numberBasic++;
+    } else if (getColumnStatus(iColumn) == basic) {
+      setColumnStatus(iColumn, superBasic);
+    }
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    if (rowIsBasic[iRow] >= 0) {
+      setRowStatus(iRow, basic);
+    } else {
+      double value = rowActivity_[iRow];
+      double lower = rowLower_[iRow];
+      double upper = rowUpper_[iRow];
+      if (lower == upper)
+        setRowStatus(iRow, isFixed);
+      else if (value <= lower + tolerance)
+        setRowStatus(iRow, atLowerBound);
+      else if (value >= upper - tolerance)
+        setRowStatus(iRow, atUpperBound);
+      else
+        setRowStatus(iRow, superBasic);
+    }
+  }
+  delete[] columnIsBasic;
+  delete[] parent;
+  int info[3];
+  info[0] = numberBlocks;
+  info[1] = numberCandidates;
+  info[2] = numberBasic;
+  eventHandler_->eventWithInfo(ClpEventHandler::startOfCrossover, info);
+  char line[100];
+  sprintf(line, "Crossover - %d blocks, %d candidates, %d made basic",
+    numberBlocks, numberCandidates, numberBasic);
+  handler_->message(CLP_GENERAL2, messages_)
+    << line << CoinMessageEol;
+  return allSlack ? -1 : numberBasic;
+}
+/* Used when primal and dual race in crossover cleanup -
+   gives up as soon as other one has finished optimal.
+   Each racer has its own clone so only finished_ is shared */
+class ClpRaceEventHandler : public ClpEventHandler {
+public:
+  ClpRaceEventHandler(ClpSimplex *model, volatile int *finished)
+    : ClpEventHandler(model)
+    , finished_(finished)
+  {
+  }
+  virtual ~ClpRaceEventHandler() {}
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfIteration && *finished_)
+      return 0;
+    else
+      return -1;
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new ClpRaceEventHandler(*this);
+  }
+
+private:
+  volatile int *finished_;
+};
+static void crossoverRace(ClpSimplex *model, int usePrimal,
+  volatile int *finished)
+{
+  if (usePrimal)
+    model->primal(1);
+  else
+    model->dual();
+  // only an optimal finish stops other one
+  if (!model->problemStatus())
+    *finished = 1;
+}
+/* Cleans up after bulkCrossoverBasis - returns problem status */
+int ClpSimplexOther::parallelCrossoverCleanup()
+{
+#if ABOCA_LITE
+  int numberThreads = abcState();
+#else
+  int numberThreads = 0;
+#endif
+  if (numberThreads < 2) {
+    primal(1);
+    return problemStatus_;
+  }
+  volatile int finished = 0;
+  /* Racers share nothing but finished - user event handler is
+     not called during race (it may not be thread safe) and dual
+     copy has its own silent message handler */
+  ClpEventHandler *saveHandler = eventHandler_->clone();
+  ClpRaceEventHandler raceHandler(this, &finished);
+  CoinMessageHandler dualHandler;
+  dualHandler.setLogLevel(0);
+  ClpSimplex dualModel(*this);
+  dualModel.passInMessageHandler(&dualHandler);
+  passInEventHandler(&raceHandler);
+  dualModel.passInEventHandler(&raceHandler);
+  cilk_spawn crossoverRace(this, 1, &finished);
+  crossoverRace(&dualModel, 0, &finished);
+  cilk_sync;
+  passInEventHandler(saveHandler);
+  delete saveHandler;
+  if (problemStatus_ && !dualModel.problemStatus()) {
+    // dual won - take its basis, solution and status
+    int numberTotal = numberRows_ + numberColumns_;
+    CoinMemcpyN(dualModel.statusArray(), numberTotal, status_);
+    CoinMemcpyN(dualModel.primalColumnSolution(), numberColumns_, columnActivity_);
+    CoinMemcpyN(dualModel.primalRowSolution(), numberRows_, rowActivity_);
+    CoinMemcpyN(dualModel.dualColumnSolution(), numberColumns_, reducedCost_);
+    CoinMemcpyN(dualModel.dualRowSolution(), numberRows_, dual_);
+    problemStatus_ = dualModel.problemStatus();
+    secondaryStatus_ = dualModel.secondaryStatus();
+    objectiveValue_ = dualModel.rawObjectiveValue();
+    numberIterations_ += dualModel.numberIterations();
+  } else if (problemStatus_ == 5) {
+    // primal stopped but dual did not finish optimal - carry on
+    primal(1);
+  }
+  return problemStatus_;
+}
+/* Finds linking vectors for blockStructure.  Major vectors (rows for
+   Dantzig-Wolfe) are candidates for linking and minor ones are grouped by
+   union-find.  Longest majors are tried as linking (doubling number each
+   time up to a tenth) and the choice which gives most even split is kept.
+   Returns number of blocks - majorBlock and minorBlock are -1 if linking */
+static int findLinking(int numberMajor, int numberMinor,
+  const CoinBigIndex *start, const int *length, const int *index,
+  int maximumBlocks, int *majorBlock, int *minorBlock)
+{
+  int *parent = new int[2 * numberMinor + 2 * numberMajor];
+  int *size = parent + numberMinor;
+  int *which = size + numberMinor;
+  int *sort = which + numberMajor;
+  int iMajor, iMinor;
+  for (iMajor = 0; iMajor < numberMajor; iMajor++) {
+    which[iMajor] = iMajor;
+    sort[iMajor] = -length[iMajor];
+  }
+  CoinSort_2(sort, sort + numberMajor, which);
+  int maximumLinking = CoinMax(1, numberMajor / 10);
+  int bestLinking = -1;
+  double bestSplit = 1.0;
+  int numberLinking = 0;
+  while (true) {
+    // union-find on minors using non linking majors
+    for (iMinor = 0; iMinor < numberMinor; iMinor++) {
+      parent[iMinor] = iMinor;
+      size[iMinor] = 0;
+    }
+    for (int i = numberLinking; i < numberMajor; i++) {
+      iMajor = which[i];
+      if (!length[iMajor])
+        continue;
+      CoinBigIndex j = start[iMajor];
+      CoinBigIndex end = j + length[iMajor];
+      int root = crossoverRoot(parent, index[j]);
+      for (j++; j < end; j++) {
+        int jRoot = crossoverRoot(parent, index[j]);
+        if (jRoot != root)
+          parent[jRoot] = root;
+      }
+    }
+    int total = 0;
+    for (int i = numberLinking; i < numberMajor; i++) {
+      iMajor = which[i];
+      if (length[iMajor]) {
+        size[crossoverRoot(parent, index[start[iMajor]])] += length[iMajor];
+        total += length[iMajor];
+      }
+    }
+    int largest = 0;
+    for (iMinor = 0; iMinor < numberMinor; iMinor++)
+      largest = CoinMax(largest, size[iMinor]);
+    // fraction in largest - only take more linking if clearly better
+    double split = total ? static_cast< double >(largest) / total : 1.0;
+    if (split < 0.9 * bestSplit) {
+      bestSplit = split;
+      bestLinking = numberLinking;
+    }
+    if (numberLinking >= maximumLinking || split < 0.1)
+      break;
+    numberLinking = numberLinking ? CoinMin(2 * numberLinking, maximumLinking) : 1;
+  }
+  int numberBlocks = 0;
+  if (bestLinking >= 0 && bestSplit <= 0.5) {
+    numberLinking = bestLinking;
+    // redo union-find
+    for (iMinor = 0; iMinor < numberMinor; iMinor++) {
+      parent[iMinor] = iMinor;
+      size[iMinor] = 0;
+      minorBlock[iMinor] = -1;
+    }
+    for (iMajor = 0; iMajor < numberMajor; iMajor++)
+      majorBlock[iMajor] = 0;
+    for (int i = 0; i < numberLinking; i++)
+      majorBlock[which[i]] = -1;
+    for (iMajor = 0; iMajor < numberMajor; iMajor++) {
+      if (majorBlock[iMajor] < 0)
+        continue;
+      CoinBigIndex end = start[iMajor] + length[iMajor];
+      for (CoinBigIndex j = start[iMajor]; j < end; j++) {
+        iMinor = index[j];
+        minorBlock[iMinor] = 0; // in a block
+        if (j > start[iMajor]) {
+          int root = crossoverRoot(parent, index[start[iMajor]]);
+          int jRoot = crossoverRoot(parent, iMinor);
+          if (jRoot != root)
+            parent[jRoot] = root;
+        }
+      }
+    }
+    // linking majors which only touch one block are not really linking
+    for (int i = 0; i < numberLinking; i++) {
+      iMajor = which[i];
+      int root = -1;
+      CoinBigIndex end = start[iMajor] + length[iMajor];
+      for (CoinBigIndex j = start[iMajor]; j < end; j++) {
+        iMinor = index[j];
+        if (minorBlock[iMinor] < 0)
+          continue;
+        int jRoot = crossoverRoot(parent, iMinor);
+        if (root < 0) {
+          root = jRoot;
+        } else if (jRoot != root) {
+          root = -2;
+          break;
+        }
+      }
+      if (root >= 0) {
+        majorBlock[iMajor] = 0;
+        for (CoinBigIndex j = start[iMajor]; j < end; j++) {
+          iMinor = index[j];
+          if (minorBlock[iMinor] < 0) {
+            minorBlock[iMinor] = 0;
+            parent[iMinor] = root;
+          }
+        }
+      }
+    }
+    // size of components
+    for (iMajor = 0; iMajor < numberMajor; iMajor++) {
+      if (majorBlock[iMajor] >= 0 && length[iMajor])
+        size[crossoverRoot(parent, index[start[iMajor]])] += length[iMajor];
+    }
+    // sort components - largest first
+    int numberComponents = 0;
+    for (iMinor = 0; iMinor < numberMinor; iMinor++) {
+      if (minorBlock[iMinor] >= 0 && parent[iMinor] == iMinor) {
+        sort[numberComponents] = -size[iMinor];
+        which[numberComponents++] = iMinor;
+      }
+    }
+    if (numberComponents > 1) {
+      CoinSort_2(sort, sort + numberComponents, which);
+      // put each into least loaded block
+      numberBlocks = CoinMin(numberComponents, maximumBlocks);
+      int *load = new int[numberBlocks];
+      CoinZeroN(load, numberBlocks);
+      for (int i = 0; i < numberComponents; i++) {
+        int iBlock = 0;
+        for (int k = 1; k < numberBlocks; k++) {
+          if (load[k] < load[iBlock])
+            iBlock = k;
+        }
+        load[iBlock] -= sort[i];
+        // size no longer needed - use for block of root
+        size[which[i]] = iBlock;
+      }
+      delete[] load;
+      for (iMinor = 0; iMinor < numberMinor; iMinor++) {
+        if (minorBlock[iMinor] >= 0)
+          minorBlock[iMinor] = size[crossoverRoot(parent, iMinor)];
+      }
+      for (iMajor = 0; iMajor < numberMajor; iMajor++) {
+        if (majorBlock[iMajor] >= 0) {
+          if (length[iMajor])
+            majorBlock[iMajor] = minorBlock[index[start[iMajor]]];
+          else
+            majorBlock[iMajor] = -1;
+        }
+      }
+    }
+  }
+  delete[] parent;
+  return numberBlocks;
+}
+/* Looks for bordered block diagonal structure.
+   Returns number of blocks (0 if no useful structure) */
+int ClpSimplexOther::blockStructure(int &type, int maximumBlocks,
+  int *rowBlock, int *columnBlock, double &linkingFraction) const
+{
+  const CoinPackedMatrix *columnCopy = matrix();
+  if (!columnCopy || columnCopy->getNumElements() == 0 || maximumBlocks < 2) {
+    linkingFraction = 1.0;
+    return 0;
+  }
+  int numberBlocks = 0;
+  int bestType = 0;
+  linkingFraction = 1.0;
+  if (type != 2) {
+    // linking rows
+    CoinPackedMatrix rowCopy;
+    rowCopy.setExtraGap(0.0);
+    rowCopy.setExtraMajor(0.0);
+    rowCopy.reverseOrderedCopyOf(*columnCopy);
+    numberBlocks = findLinking(numberRows_, numberColumns_,
+      rowCopy.getVectorStarts(), rowCopy.getVectorLengths(),
+      rowCopy.getIndices(), maximumBlocks, rowBlock, columnBlock);
+    if (numberBlocks) {
+      int numberLinking = 0;
+      for (int iRow = 0; iRow < numberRows_; iRow++) {
+        if (rowBlock[iRow] < 0)
+          numberLinking++;
+      }
+      linkingFraction = static_cast< double >(numberLinking) / numberRows_;
+      bestType = 1;
+    }
+  }
+  if (type != 1) {
+    // linking columns
+    int *tempRow = new int[numberRows_ + numberColumns_];
+    int *tempColumn = tempRow + numberRows_;
+    int numberBlocks2 = findLinking(numberColumns_, numberRows_,
+      columnCopy->getVectorStarts(), columnCopy->getVectorLengths(),
+      columnCopy->getIndices(), maximumBlocks, tempColumn, tempRow);
+    if (numberBlocks2) {
+      int numberLinking = 0;
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        if (tempColumn[iColumn] < 0)
+          numberLinking++;
+      }
+      double fraction = static_cast< double >(numberLinking) / numberColumns_;
+      if (fraction < linkingFraction) {
+        linkingFraction = fraction;
+        numberBlocks = numberBlocks2;
+        bestType = 2;
+        CoinMemcpyN(tempRow, numberRows_, rowBlock);
+        CoinMemcpyN(tempColumn, numberColumns_, columnBlock);
+      }
+    }
+    delete[] tempRow;
+  }
+  type = bestType;
+  char line[100];
+  if (numberBlocks) {
+    sprintf(line, "Structure - %d blocks, %.2f%% linking %s",
+      numberBlocks, 100.0 * linkingFraction,
+      type == 1 ? "rows" : "columns");
+  } else {
+    sprintf(line, "No block structure found");
+  }
+  handler_->message(CLP_GENERAL, messages_)
+    << line << CoinMessageEol;
+  return numberBlocks;
+}
+/* Creates structured model from output of blockStructure.
+   Caller owns result */
+CoinStructuredModel *
+ClpSimplexOther::structuredModel(int type, int numberBlocks,
+  const int *rowBlock, const int *columnBlock) const
+{
+  // master is last block
+  int nBlocks = numberBlocks + 1;
+  int masterBlock = numberBlocks;
+  int *rowStart = new int[2 * nBlocks + 2];
+  int *columnStart = rowStart + nBlocks + 1;
+  int *rowList = new int[2 * numberRows_ + 2 * numberColumns_];
+  int *rowLocal = rowList + numberRows_;
+  int *columnList = rowLocal + numberRows_;
+  int *columnLocal = columnList + numberColumns_;
+  CoinZeroN(rowStart, 2 * nBlocks + 2);
+  int iRow, iColumn, iBlock;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    iBlock = rowBlock[iRow] >= 0 ? rowBlock[iRow] : masterBlock;
+    rowLocal[iRow] = rowStart[iBlock + 1]++;
+  }
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    iBlock = columnBlock[iColumn] >= 0 ? columnBlock[iColumn] : masterBlock;
+    columnLocal[iColumn] = columnStart[iBlock + 1]++;
+  }
+  for (iBlock = 0; iBlock < nBlocks; iBlock++) {
+    rowStart[iBlock + 1] += rowStart[iBlock];
+    columnStart[iBlock + 1] += columnStart[iBlock];
+  }
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    iBlock = rowBlock[iRow] >= 0 ? rowBlock[iRow] : masterBlock;
+    rowList[rowStart[iBlock] + rowLocal[iRow]] = iRow;
+  }
+  for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    iBlock = columnBlock[iColumn] >= 0 ? columnBlock[iColumn] : masterBlock;
+    columnList[columnStart[iBlock] + columnLocal[iColumn]] = iColumn;
+  }
+  // which element blocks exist - diagonal and master always
+  CoinPackedMatrix rowCopy;
+  rowCopy.setExtraGap(0.0);
+  rowCopy.setExtraMajor(0.0);
+  rowCopy.reverseOrderedCopyOf(*matrix());
+  const int *column = rowCopy.getIndices();
+  const CoinBigIndex *rowStartCopy = rowCopy.getVectorStarts();
+  const int *rowLength = rowCopy.getVectorLengths();
+  const double *element = rowCopy.getElements();
+  char *exists = new char[nBlocks * nBlocks];
+  CoinZeroN(exists, nBlocks * nBlocks);
+  for (iBlock = 0; iBlock < nBlocks; iBlock++)
+    exists[iBlock * nBlocks + iBlock] = 1;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    int iRowBlock = rowBlock[iRow] >= 0 ? rowBlock[iRow] : masterBlock;
+    for (CoinBigIndex j = rowStartCopy[iRow]; j < rowStartCopy[iRow] + rowLength[iRow]; j++) {
+      iColumn = column[j];
+      int iColumnBlock = columnBlock[iColumn] >= 0 ? columnBlock[iColumn] : masterBlock;
+      exists[iRowBlock * nBlocks + iColumnBlock] = 1;
+    }
+  }
+  assert(type == 1 || type == 2);
+  CoinStructuredModel *model = new CoinStructuredModel();
+  model->setObjectiveOffset(objectiveOffset());
+  // objective is kept as it is (solve applies direction)
+  model->setOptimizationDirection(optimizationDirection_);
+  int *which = new int[numberColumns_];
+  double *elements = new double[numberColumns_];
+  char name[20];
+  for (int iRowBlock = 0; iRowBlock < nBlocks; iRowBlock++) {
+    std::string rowName;
+    if (iRowBlock == masterBlock) {
+      rowName = "master";
+    } else {
+      sprintf(name, "block_%d", iRowBlock);
+      rowName = name;
+    }
+    for (int iColumnBlock = 0; iColumnBlock < nBlocks; iColumnBlock++) {
+      if (!exists[iRowBlock * nBlocks + iColumnBlock])
+        continue;
+      std::string columnName;
+      if (iColumnBlock == masterBlock) {
+        columnName = "master";
+      } else {
+        sprintf(name, "block_%d", iColumnBlock);
+        columnName = name;
+      }
+      // rim data goes on diagonal blocks
+      bool diagonal = (iRowBlock == iColumnBlock);
+      CoinModel block;
+      for (int k = rowStart[iRowBlock]; k < rowStart[iRowBlock + 1]; k++) {
+        iRow = rowList[k];
+        int n = 0;
+        for (CoinBigIndex j = rowStartCopy[iRow]; j < rowStartCopy[iRow] + rowLength[iRow]; j++) {
+          iColumn = column[j];
+          int jBlock = columnBlock[iColumn] >= 0 ? columnBlock[iColumn] : masterBlock;
+          if (jBlock == iColumnBlock) {
+            which[n] = columnLocal[iColumn];
+            elements[n++] = element[j];
+          }
+        }
+        if (diagonal)
+          block.addRow(n, which, elements, rowLower_[iRow], rowUpper_[iRow]);
+        else
+          block.addRow(n, which, elements, -COIN_DBL_MAX, COIN_DBL_MAX);
+      }
+      int numberColumns2 = columnStart[iColumnBlock + 1] - columnStart[iColumnBlock];
+      if (diagonal) {
+        for (int k = 0; k < numberColumns2; k++) {
+          iColumn = columnList[columnStart[iColumnBlock] + k];
+          block.setColumnBounds(k, columnLower_[iColumn], columnUpper_[iColumn]);
+          block.setColumnObjective(k, objective()[iColumn]);
+        }
+      } else if (numberColumns2) {
+        // make sure all columns there
+        block.setColumnBounds(numberColumns2 - 1, 0.0, COIN_DBL_MAX);
+      }
+      block.convertMatrix();
+      block.setOriginalIndices(rowList + rowStart[iRowBlock],
+        columnList + columnStart[iColumnBlock]);
+      model->addBlock(rowName, columnName, block);
+    }
+  }
+  delete[] which;
+  delete[] elements;
+  delete[] exists;
+  delete[] rowList;
+  delete[] rowStart;
+  return model;
+}
 // Returns gub version of model or NULL
 ClpSimplex *
 ClpSimplexOther::gubVersion(int *whichRows, int *whichColumns,
@@ -258,6 +258,38 @@ public:
     const int *whichColumns) const;
   /// Quick try at cleaning up duals if postsolve gets wrong
   void cleanupAfterPostsolve();
+  /** Crossover - builds basis in one go rather than pivot by pivot.
+         Superbasic columns (more than tolerance from both bounds) and
+         existing basic columns are split into independent blocks (no
+         shared rows).  At most as many columns as rows in block are tried
+         (furthest from bounds first) and one factorization decides which
+         become basic.  Near-bound superbasics are moved to bounds.
+         Progress is reported via eventWithInfo(startOfCrossover) with
+         int[3] - number of blocks, number of candidates, number made basic.
+         Returns number of columns made basic or -1 if all slack used.
+     */
+  int bulkCrossoverBasis(double tolerance);
+  /** Cleans up after bulkCrossoverBasis.  If more than one thread
+         available primal and dual are raced on copies and first to
+         finish is kept, otherwise just primal.  Returns problem status.
+     */
+  int parallelCrossoverCleanup();
+  /** Looks for bordered block diagonal structure.
+         type 1 - linking rows (Dantzig-Wolfe), 2 - linking columns (Benders),
+         0 - try both and set type to one with smaller linking fraction.
+         On exit rowBlock and columnBlock have block or -1 for linking
+         (master) rows and columns and linkingFraction is fraction of
+         rows (or columns) which are linking.
+         Returns number of blocks (0 if no useful structure).
+     */
+  int blockStructure(int &type, int maximumBlocks, int *rowBlock,
+    int *columnBlock, double &linkingFraction) const;
+  /** Creates structured model from output of blockStructure.
+         Blocks know original rows and columns so solveDW or solveBenders
+         can put solution back.  Caller owns result.
+     */
+  CoinStructuredModel *structuredModel(int type, int numberBlocks,
+    const int *rowBlock, const int *columnBlock) const;
   /** Tightens integer bounds - returns number tightened or -1 if infeasible
      */
   int tightenIntegerBounds(double *rhsSpace);
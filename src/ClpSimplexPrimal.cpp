@@ -778,6 +778,11 @@ int ClpSimplexPrimal::whileIterating(int valuesOption)
 #endif
       // do second half of iteration
       returnCode = pivotResult(ifValuesPass);
+#if ABOCA_LITE
+      // maybe factorize current basis while iterating (synchronized on return)
+      if (returnCode == -1 && startEarlyFactorization())
+        cilk_spawn doEarlyFactorization();
+#endif
       if (returnCode < -1 && returnCode > -5) {
         problemStatus_ = -2; //
       } else if (returnCode == -5) {
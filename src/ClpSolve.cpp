@@ -24,9 +24,14 @@
 #include "CoinHelperFunctions.hpp"
 #include "ClpHelperFunctions.hpp"
 #include "CoinSort.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpFactorization.hpp"
 #include "ClpSimplex.hpp"
 #include "ClpSimplexOther.hpp"
+#include "ClpSimplexNetwork.hpp"
 #include "ClpSimplexDual.hpp"
 #ifndef SLIM_CLP
 #include "ClpQuadraticObjective.hpp"
@@ -577,6 +582,12 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
     //this->writeBasis("a.bas",true);
   } else {
     abcModel2 = new AbcSimplex(*this);
+#if CLP_POOL_MATRIX
+    if (dynamic_cast< ClpPoolMatrix * >(matrix_)) {
+      // Abc has its own copy so get rid of expanded one
+      matrix_->releasePackedMatrix();
+    }
+#endif
     if (interrupt)
       currentAbcModel = abcModel2;
     //if (abcSimplex_) {
@@ -837,6 +848,51 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
   return abcModel2;
 }
 #endif
+#if ABOCA_LITE
+/* Sprint pricing for a chunk of columns.
+   dj = cost - pi*A, also counts columns which price out
+   (theta is optimization direction) */
+static void
+sprintPriceBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT cost = info.cost;
+  double *COIN_RESTRICT djs = info.reducedCost;
+  const double *COIN_RESTRICT pi = info.work;
+  const double *COIN_RESTRICT solution = info.solution;
+  const double *COIN_RESTRICT lower = info.lower;
+  const double *COIN_RESTRICT upper = info.upper;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  const int *COIN_RESTRICT columnLength = info.which;
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.start;
+  const int *COIN_RESTRICT row = info.row;
+  const double *COIN_RESTRICT element = info.element;
+  double direction = info.theta;
+  double dualTolerance = info.dualTolerance;
+  int numberNegative = 0;
+  double sumNegative = 0.0;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int iColumn = first; iColumn < last; iColumn++) {
+    double value = cost[iColumn];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++)
+      value -= pi[row[j]] * element[j];
+    djs[iColumn] = value;
+    if ((status[iColumn] & 7) != ClpSimplex::basic) {
+      double dj = value * direction;
+      if (dj < -dualTolerance && solution[iColumn] < upper[iColumn]) {
+        numberNegative++;
+        sumNegative -= dj;
+      } else if (dj > dualTolerance && solution[iColumn] > lower[iColumn]) {
+        numberNegative++;
+        sumNegative += dj;
+      }
+    }
+  }
+  info.numberAdded = numberNegative;
+  info.changeObj = sumNegative;
+}
+#endif
 /** General solve algorithm which can do presolve
     special options (bits)
     1 - do not perturb
@@ -1250,18 +1306,24 @@ int ClpSimplex::initialSolve(ClpSolve &options)
   int primalStartup = 1;
   model2->eventHandler()->event(ClpEventHandler::presolveBeforeSolve);
 #if CLP_POOL_MATRIX
-  if (vectorMode() >= 10) {
+  if (vectorMode() >= 10 && model2->clpMatrix()->type() == 1
+    && objective_->type() < 2) {
     ClpPoolMatrix *poolMatrix = new ClpPoolMatrix(*model2->matrix());
     char output[80];
     int numberDifferent = poolMatrix->getNumDifferentElements();
-    if (numberDifferent > 0) {
+    if (poolMatrix->getNumCols() >= 0) {
       sprintf(output, "Pool matrix has %d different values",
         numberDifferent);
-      model2->replaceMatrix(poolMatrix, true);
+      // put back at end (or delete if presolved)
+      saveMatrix = model2->clpMatrix();
+      model2->replaceMatrix(poolMatrix, false);
     } else {
       delete poolMatrix;
-      sprintf(output, "Pool matrix has more than %d different values - no good",
-        -numberDifferent);
+      if (numberDifferent)
+        sprintf(output, "Pool matrix has more than %d different values - no good",
+          -numberDifferent);
+      else
+        sprintf(output, "Too many rows for pool matrix");
     }
     handler_->message(CLP_GENERAL, messages_) << output
                                               << CoinMessageEol;
@@ -1449,6 +1511,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       method = ClpSolve::useBarrierNoCross;
     else if (method != ClpSolve::useBarrierNoCross)
       method = ClpSolve::usePrimal;
+  } else if (objective_->type() >= 2) {
+    // other nonlinear (e.g. low rank) - only primal knows about it
+    doSprint = 0;
+    method = ClpSolve::usePrimal;
   }
 #ifdef COIN_HAS_VOL
   // Save number of idiot
@@ -1499,6 +1565,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
 #ifndef SLIM_CLP
   // Statistics (+1,-1, other) - used to decide on strategy if not +-1
   CoinBigIndex statistics[3] = { -1, 0, 0 };
+  if (plusMinus && saveMatrix) {
+    // already using pool matrix
+    plusMinus = false;
+  }
   if (plusMinus) {
     saveMatrix = model2->clpMatrix();
 #ifndef NO_RTTI
@@ -1688,6 +1758,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       }
     }
   }
+  bool tryBendersStructure = false;
   if (method == ClpSolve::tryBenders) {
     // Now build model
     int lengthNames = model2->lengthNames();
@@ -1713,12 +1784,68 @@ int ClpSimplex::initialSolve(ClpSolve &options)
         << CoinMessageEol;
       timeX = time2;
     } else {
+      // try own detection of linking columns
+      tryBendersStructure = true;
+    }
+  }
+  // automatic may look for bordered block structure if asked
+  bool tryDecompose = wasAutomatic && (options.getSpecialOption(3) & 2) != 0
+    && method != ClpSolve::notImplemented;
+  if (method == ClpSolve::tryDantzigWolfe || tryDecompose || tryBendersStructure) {
+    int *rowBlock = new int[numberRows + numberColumns];
+    int *columnBlock = rowBlock + numberRows;
+    int type = tryBendersStructure ? 2 : ((method == ClpSolve::tryDantzigWolfe) ? 1 : 0);
+    int maximumBlocks = options.independentOption(0);
+    if (maximumBlocks < 2)
+      maximumBlocks = 16;
+    double linkingFraction;
+    int numberBlocks = static_cast< ClpSimplexOther * >(model2)->blockStructure(type, maximumBlocks, rowBlock, columnBlock, linkingFraction);
+    // only worth it if border small (and more so if not asked for)
+    if (linkingFraction > (tryDecompose ? 0.02 : 0.2))
+      numberBlocks = 0;
+    if (numberBlocks) {
+      CoinStructuredModel *structured = static_cast< ClpSimplexOther * >(model2)->structuredModel(type, numberBlocks, rowBlock, columnBlock);
+      ClpSolve decomposeOptions = options;
+      // 2 is substitution unless set for passes
+      if (decomposeOptions.independentOption(2) < 10)
+        decomposeOptions.setIndependentOption(2, 100);
+      if (type == 1) {
+        model2->solveDW(structured, decomposeOptions);
+      } else {
+        decomposeOptions.setIndependentOption(1, 1); // don't do final clean up
+        model2->solveBenders(structured, decomposeOptions);
+      }
+      delete structured;
+      method = ClpSolve::notImplemented;
+      time2 = CoinCpuTime();
+      timeCore = time2 - timeX;
+      handler_->message(CLP_INTERVAL_TIMING, messages_)
+        << "Decomposition" << timeCore << time2 - time1
+        << CoinMessageEol;
+      timeX = time2;
+    } else if (method == ClpSolve::tryDantzigWolfe || tryBendersStructure) {
       printf("No structure\n");
       method = ClpSolve::useDual;
     }
-  } else if (method == ClpSolve::tryDantzigWolfe) {
-    abort();
+    delete[] rowBlock;
+  }
+#ifndef SLIM_CLP
+  // pure network from slack basis - use network simplex unless asked not to
+  if (model2->clpMatrix()->type() == 11 && objective_->type() < 2
+    && numberRowsBasic == numberRows && (options.getSpecialOption(3) & 4) == 0
+    && (method == ClpSolve::useDual || method == ClpSolve::usePrimal
+      || method == ClpSolve::usePrimalorSprint)) {
+    if (static_cast< ClpSimplexNetwork * >(model2)->network() >= 0) {
+      method = ClpSolve::notImplemented;
+      time2 = CoinCpuTime();
+      timeCore = time2 - timeX;
+      handler_->message(CLP_INTERVAL_TIMING, messages_)
+        << "Network" << timeCore << time2 - time1
+        << CoinMessageEol;
+      timeX = time2;
+    }
   }
+#endif
   if (method == ClpSolve::usePrimalorSprint) {
     if (doSprint < 0) {
       if (numberElements < 500000) {
@@ -2953,6 +3080,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       }
       int smallIterations = small.numberIterations();
       totalIterations += smallIterations;
+      // price out resize is not done on pass where stall logic grew set
+      bool sizeChanged = false;
       if (2 * smallIterations < CoinMin(numberRows, 1000) && iPass) {
         int oldNumber = smallNumberColumns;
         if (smallIterations < 100)
@@ -2966,6 +3095,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
           smallNumberColumns = numberColumns;
         }
         //		 smallNumberColumns = CoinMin(smallNumberColumns, 3*saveSmallNumber);
+        sizeChanged = (smallNumberColumns != oldNumber);
         char line[100];
         sprintf(line, "sample size increased from %d to %d",
           oldNumber, smallNumberColumns);
@@ -2997,24 +3127,93 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       lastSumArtificials = sumArtificials;
       // get reduced cost for large problem
       double *djs = model2->dualColumnSolution();
-      CoinMemcpyN(model2->objective(), numberColumns, djs);
-      model2->clpMatrix()->transposeTimes(-1.0, small.dualRowSolution(), djs);
       int numberNegative = 0;
       double sumNegative = 0.0;
       // now massage weight so all basic in plus good djs
       // first count and do basic
       numberSort = 0;
-      for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-        double dj = djs[iColumn] * optimizationDirection_;
-        double value = fullSolution[iColumn];
-        if (model2->getColumnStatus(iColumn) == ClpSimplex::basic) {
-          sort[numberSort++] = iColumn;
-        } else if (dj < -dualTolerance_ && value < columnUpper[iColumn]) {
-          numberNegative++;
-          sumNegative -= dj;
-        } else if (dj > dualTolerance_ && value > columnLower[iColumn]) {
-          numberNegative++;
-          sumNegative += dj;
+#if ABOCA_LITE
+      int numberThreads = abcState();
+      if (numberThreads > 1 && dynamic_cast< ClpPackedMatrix * >(model2->clpMatrix())) {
+        // full pricing is the expensive part of a pass - do in chunks
+        const CoinPackedMatrix *matrix = model2->matrix();
+        clpTempInfo info[ABOCA_LITE];
+        int chunk = (numberColumns + numberThreads - 1) / numberThreads;
+        int n = 0;
+        for (int i = 0; i < numberThreads; i++) {
+          info[i].cost = model2->objective();
+          info[i].reducedCost = djs;
+          info[i].work = small.dualRowSolution();
+          info[i].solution = fullSolution;
+          info[i].lower = columnLower;
+          info[i].upper = columnUpper;
+          info[i].status = model2->statusArray();
+          info[i].which = const_cast< int * >(matrix->getVectorLengths());
+          info[i].start = matrix->getVectorStarts();
+          info[i].row = matrix->getIndices();
+          info[i].element = matrix->getElements();
+          info[i].theta = optimizationDirection_;
+          info[i].dualTolerance = dualTolerance_;
+          info[i].startColumn = n;
+          info[i].numberToDo = CoinMax(CoinMin(chunk, numberColumns - n), 0);
+          n += chunk;
+        }
+        for (int i = 0; i < numberThreads; i++)
+          cilk_spawn sprintPriceBit(info[i]);
+        cilk_sync;
+        for (int i = 0; i < numberThreads; i++) {
+          numberNegative += info[i].numberAdded;
+          sumNegative += info[i].changeObj;
+        }
+        for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+          if (model2->getColumnStatus(iColumn) == ClpSimplex::basic)
+            sort[numberSort++] = iColumn;
+        }
+      } else {
+#endif
+        CoinMemcpyN(model2->objective(), numberColumns, djs);
+        model2->clpMatrix()->transposeTimes(-1.0, small.dualRowSolution(), djs);
+        for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+          double dj = djs[iColumn] * optimizationDirection_;
+          double value = fullSolution[iColumn];
+          if (model2->getColumnStatus(iColumn) == ClpSimplex::basic) {
+            sort[numberSort++] = iColumn;
+          } else if (dj < -dualTolerance_ && value < columnUpper[iColumn]) {
+            numberNegative++;
+            sumNegative -= dj;
+          } else if (dj > dualTolerance_ && value > columnLower[iColumn]) {
+            numberNegative++;
+            sumNegative += dj;
+          }
+        }
+#if ABOCA_LITE
+      }
+#endif
+      if (!emergencyMode && iPass && !sizeChanged) {
+        /* Size working set from how many columns price out -
+           room for basic plus a couple of candidates each, but
+           never less than half original or more than half as much again */
+        int wanted = numberSort + 2 * numberNegative;
+        wanted = CoinMax(wanted, saveSmallNumber / 2);
+        wanted = CoinMax(wanted, numberSort + 100);
+        wanted = CoinMin(wanted, (3 * smallNumberColumns) / 2);
+        wanted = CoinMin(wanted, numberColumns);
+        if (wanted < smallNumberColumns && wanted < (9 * smallNumberColumns) / 10) {
+          char line[100];
+          sprintf(line, "sample size decreased from %d to %d",
+            smallNumberColumns, wanted);
+          handler_->message(CLP_GENERAL2, messages_)
+            << line
+            << CoinMessageEol;
+          smallNumberColumns = wanted;
+        } else if (wanted > (11 * smallNumberColumns) / 10) {
+          char line[100];
+          sprintf(line, "sample size increased from %d to %d (%d price out)",
+            smallNumberColumns, wanted, numberNegative);
+          handler_->message(CLP_GENERAL2, messages_)
+            << line
+            << CoinMessageEol;
+          smallNumberColumns = wanted;
         }
       }
       handler_->message(CLP_SPRINT, messages_)
@@ -3178,6 +3377,11 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       speed = (barrierOptions & (2048 | 4096)) >> 11;
       barrierOptions &= ~(2048 | 4096);
     }
+    bool bulkCrossover = false;
+    if (barrierOptions & 8192) {
+      barrierOptions &= ~8192;
+      bulkCrossover = true;
+    }
     if (barrierOptions & 8) {
       barrierOptions &= ~8;
       scale = true;
@@ -3562,11 +3766,15 @@ int ClpSimplex::initialSolve(ClpSolve &options)
               primalSolution[i] = columnUpper[i];
             }
           }
-          CoinSort_2(dsort, dsort + n, sort);
-          n = CoinMin(numberRows, n);
-          for (i = 0; i < n; i++) {
-            int iColumn = sort[i];
-            model2->setStatus(iColumn, basic);
+          if (!bulkCrossover) {
+            CoinSort_2(dsort, dsort + n, sort);
+            n = CoinMin(numberRows, n);
+            for (i = 0; i < n; i++) {
+              int iColumn = sort[i];
+              model2->setStatus(iColumn, basic);
+            }
+          } else {
+            static_cast< ClpSimplexOther * >(model2)->bulkCrossoverBasis(tolerance);
           }
           delete[] sort;
           delete[] dsort;
@@ -3675,7 +3883,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
         model2->setObjectiveScale(1.0e-3);
         model2->primal(2);
         model2->setObjectiveScale(saveScale);
-        model2->primal(1);
+        if (!bulkCrossover)
+          model2->primal(1);
+        else
+          static_cast< ClpSimplexOther * >(model2)->parallelCrossoverCleanup();
 #endif
 #else
         // just primal
@@ -3744,7 +3955,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
     abort();
 #endif
   } else if (method == ClpSolve::notImplemented) {
-    printf("done decomposition\n");
+    // already done by decomposition or network simplex
   } else {
     assert(method != ClpSolve::automatic); // later
     time2 = 0.0;
@@ -5164,6 +5375,13 @@ void *clp_parallelManager(void *stuff)
       else
         returnCode = clpSimplex->primal();
       break;
+    case 2:
+      // Dantzig-Wolfe block - old basis still primal feasible
+      if (iPass)
+        returnCode = clpSimplex->primal();
+      else
+        returnCode = clpSimplex->dual();
+      break;
     case 100:
       // initialization
       break;
@@ -5176,6 +5394,15 @@ void *clp_parallelManager(void *stuff)
   }
 }
 #endif
+// Solves one Dantzig-Wolfe block (old basis still primal feasible)
+static void
+solveDWBlock(ClpSimplex *sub, int iPass)
+{
+  if (iPass)
+    sub->primal();
+  else
+    sub->dual();
+}
 // Solve using Dantzig-Wolfe decomposition and maybe in parallel
 int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
 {
@@ -5462,6 +5689,19 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
   //abcMaster.startThreads(numberCpu);
   //#define master abcMaster
 #endif
+  /* Blocks keep their ClpSimplex (and so basis) between passes.
+     If a block's pricing objective is unchanged and its last proposal
+     went in on previous pass then it has nothing new to offer. */
+  double **saveObj2 = new double *[numberBlocks];
+  double **lastPrice = new double *[numberBlocks];
+  int *lastTaken = new int[numberBlocks];
+  char *skipBlock = new char[numberBlocks];
+  for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+    int numberColumns2 = sub[iBlock].numberColumns();
+    saveObj2[iBlock] = new double[numberColumns2];
+    lastPrice[iBlock] = new double[numberColumns2];
+    lastTaken[iBlock] = -2;
+  }
   for (iPass = 0; iPass < maxPass; iPass++) {
     sprintf(generalPrint, "Start of pass %d", iPass);
     handler_->message(CLP_GENERAL, messages_)
@@ -5587,23 +5827,43 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
         when[iColumn] = iPass;
     }
     if (numberColumnsGenerated + numberBlocks > maximumColumns) {
-      // delete
+      // delete - first ones not basic for a while
       int numberKeep = 0;
       int numberDelete = 0;
       int *whichDelete = new int[numberColumnsGenerated];
+      int cutoff = iPass - 7;
+      // if not enough go for younger non basic (basic ones are always kept)
+      int numberOld = 0;
+      for (iColumn = 0; iColumn < numberColumnsGenerated; iColumn++) {
+        if (when[iColumn] <= cutoff)
+          numberOld++;
+      }
+      while (numberColumnsGenerated - numberOld + numberBlocks > maximumColumns && cutoff < iPass - 1) {
+        cutoff++;
+        for (iColumn = 0; iColumn < numberColumnsGenerated; iColumn++) {
+          if (when[iColumn] == cutoff)
+            numberOld++;
+        }
+      }
       for (iColumn = 0; iColumn < numberColumnsGenerated; iColumn++) {
-        if (when[iColumn] > iPass - 7) {
+        if (when[iColumn] > cutoff) {
           // keep
           when[numberKeep] = when[iColumn];
           whichBlock[numberKeep++] = whichBlock[iColumn];
         } else {
-          // delete
+          // delete (and make sure block is priced again)
           whichDelete[numberDelete++] = iColumn + numberMasterColumns;
+          lastTaken[whichBlock[iColumn]] = -2;
         }
       }
       numberColumnsGenerated -= numberDelete;
       master.deleteColumns(numberDelete, whichDelete);
       delete[] whichDelete;
+      sprintf(generalPrint, "%d proposals taken out of master, %d left",
+        numberDelete, numberColumnsGenerated);
+      handler_->message(CLP_GENERAL2, messages_)
+        << generalPrint
+        << CoinMessageEol;
     }
     const double *dual = NULL;
     bool deleteDual = false;
@@ -5635,11 +5895,7 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
     // Create objective for sub problems and solve
     columnAdd[0] = 0;
     int numberProposals = 0;
-    double **saveObj2 = new double *[numberBlocks];
-    for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
-      int numberColumns2 = sub[iBlock].numberColumns();
-      saveObj2[iBlock] = new double[numberColumns2];
-    }
+    int numberSkipped = 0;
     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
       int numberColumns2 = sub[iBlock].numberColumns();
       double *saveObj = saveObj2[iBlock];
@@ -5661,40 +5917,67 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
 
       if (reducePrint)
         sub[iBlock].setLogLevel(0);
+      // same prices and proposal already in master?
+      skipBlock[iBlock] = 0;
+      if (lastTaken[iBlock] == iPass - 1 && sub[iBlock].isProvenOptimal() && !memcmp(objective2, lastPrice[iBlock], numberColumns2 * sizeof(double))) {
+        skipBlock[iBlock] = 1;
+        numberSkipped++;
+      } else {
+        memcpy(lastPrice[iBlock], objective2, numberColumns2 * sizeof(double));
+      }
+    }
+    if (numberSkipped) {
+      sprintf(generalPrint, "%d blocks have same prices as last pass", numberSkipped);
+      handler_->message(CLP_GENERAL2, messages_)
+        << generalPrint
+        << CoinMessageEol;
     }
 #if defined(ABC_INHERIT)
     if (numberCpu < 2) {
+#elif ABOCA_LITE
+    if (abcState() < 2) {
 #endif
       for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
-        if (iPass) {
-          sub[iBlock].primal();
-        } else {
-          sub[iBlock].dual();
-        }
+        if (!skipBlock[iBlock])
+          solveDWBlock(sub + iBlock, iPass);
       }
 #if defined(ABC_INHERIT)
     } else {
       int iBlock = 0;
       while (iBlock < numberBlocks) {
-        if (sub[iBlock].secondaryStatus() != 99 || true) {
+        if (!skipBlock[iBlock]) {
           int iThread;
-          threadInfo.waitParallelTask(1, iThread, true);
+          threadInfo.waitParallelTask(2, iThread, true);
 #ifdef DETAIL_THREAD
           printf("Starting block %d on thread %d\n",
             iBlock, iThread);
 #endif
-          threadInfo.startParallelTask(1, iThread, sub + iBlock);
+          threadInfo.threadInfoPointer(iThread)->stuff[1] = iPass;
+          threadInfo.startParallelTask(2, iThread, sub + iBlock);
         }
         iBlock++;
       }
       threadInfo.waitAllTasks();
     }
+#elif ABOCA_LITE
+    } else {
+      // blocks are independent
+      for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        if (!skipBlock[iBlock])
+          cilk_spawn solveDWBlock(sub + iBlock, iPass);
+      }
+      cilk_sync;
+    }
 #endif
     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
       int numberColumns2 = sub[iBlock].numberColumns();
       double *saveObj = saveObj2[iBlock];
       double *objective2 = sub[iBlock].objective();
       int i;
+      if (skipBlock[iBlock]) {
+        memcpy(objective2, saveObj, numberColumns2 * sizeof(double));
+        continue;
+      }
       sub[iBlock].scaleObjective(scaleFactor);
       if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenDualInfeasible()) {
         memset(objective2, 0, numberColumns2 * sizeof(double));
@@ -5755,6 +6038,7 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
             columnAdd[++numberProposals] = number;
             when[numberColumnsGenerated] = iPass;
             whichBlock[numberColumnsGenerated++] = iBlock;
+            lastTaken[iBlock] = iPass;
           }
         } else if (sub[iBlock].isProvenDualInfeasible()) {
           // use ray
@@ -5796,15 +6080,20 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
         }
       }
     }
-    for (iBlock = 0; iBlock < numberBlocks; iBlock++)
-      delete[] saveObj2[iBlock];
-    delete[] saveObj2;
     if (deleteDual)
       delete[] dual;
     if (numberProposals)
       master.addColumns(numberProposals, NULL, NULL, objective,
         columnAdd, rowAdd, elementAdd);
   }
+  for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+    delete[] saveObj2[iBlock];
+    delete[] lastPrice[iBlock];
+  }
+  delete[] saveObj2;
+  delete[] lastPrice;
+  delete[] lastTaken;
+  delete[] skipBlock;
   sprintf(generalPrint, "Time at end of D-W %.2f seconds", CoinCpuTime() - time1);
   handler_->message(CLP_GENERAL, messages_)
     << generalPrint
@@ -6009,6 +6298,111 @@ static ClpSimplex *deBound(ClpSimplex *oldModel)
   delete[] change;
   return model;
 }
+// Solves one Benders subproblem (warm started from last pass)
+static void
+solveBendersBlock(ClpSimplex *sub, int iBlock, int iPass, int maxPass,
+  int scalingFlag, double treatSubAsFeasible, int &state)
+{
+  //int ix=sub->secondaryStatus();
+  int lastStatus = sub->problemStatus();
+  // was do dual unless unbounded
+  double saveTolerance = sub->primalTolerance();
+  if (lastStatus == 0 || !iPass) {
+    //if (lastStatus<2||!iPass) {
+    //sub->dual();
+    sub->primal();
+    if (!sub->isProvenOptimal() && sub->sumPrimalInfeasibilities() < treatSubAsFeasible) {
+      printf("Block %d was feasible now has small infeasibility %g\n", iBlock,
+        sub->sumPrimalInfeasibilities());
+      sub->setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+      sub->setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+      sub->primal();
+      sub->setProblemStatus(0);
+      state |= 4; // force actions
+    }
+    if ((maxPass == 5000 && scalingFlag) || (maxPass == 4000 && !scalingFlag)) {
+      int n = sub->numberIterations();
+      sub->scaling(0);
+      sub->primal();
+      sub->setNumberIterations(n + sub->numberIterations());
+      sub->scaling(scalingFlag);
+    }
+  } else if (lastStatus == 1) {
+    // zero out objective
+    double saveScale = sub->infeasibilityCost();
+    ClpObjective *saveObjective = sub->objectiveAsObject();
+    int numberColumns = sub->numberColumns();
+    ClpLinearObjective fake(NULL, numberColumns);
+    sub->setObjectivePointer(&fake);
+    int saveOptions = sub->specialOptions();
+    sub->setSpecialOptions(saveOptions | 8192);
+    sub->primal();
+    if ((maxPass == 5000 && scalingFlag) || (maxPass == 4000 && !scalingFlag)) {
+      int n = sub->numberIterations();
+      sub->scaling(0);
+      sub->primal();
+      sub->setNumberIterations(n + sub->numberIterations());
+      sub->scaling(scalingFlag);
+    }
+    sub->setObjectivePointer(saveObjective);
+    sub->setInfeasibilityCost(saveScale);
+    if (!sub->isProvenOptimal() && sub->sumPrimalInfeasibilities() < treatSubAsFeasible) {
+      printf("Block %d was infeasible now has small infeasibility %g\n", iBlock,
+        sub->sumPrimalInfeasibilities());
+      sub->setProblemStatus(0);
+      sub->setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+      sub->setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+    }
+    if (sub->isProvenOptimal()) {
+      sub->primal();
+      if ((maxPass == 5000 && scalingFlag) || (maxPass == 4000 && !scalingFlag)) {
+        int n = sub->numberIterations();
+        sub->scaling(0);
+        sub->primal();
+        sub->setNumberIterations(n + sub->numberIterations());
+        sub->scaling(scalingFlag);
+      }
+      if (!sub->isProvenOptimal()) {
+        printf("Block %d infeasible on second go has small infeasibility %g\n", iBlock,
+          sub->sumPrimalInfeasibilities());
+        sub->setProblemStatus(0);
+      }
+      state |= 4; // force actions
+    } else {
+      printf("Block %d still infeasible - sum %g - %d iterations\n", iBlock,
+        sub->sumPrimalInfeasibilities(),
+        sub->numberIterations());
+      state |= 8; // still infeasible
+      if (!sub->ray()) {
+        printf("Block %d has no ray!\n", iBlock);
+        sub->primal();
+        assert(sub->ray()); // otherwise declare optimal
+      }
+    }
+    sub->setSpecialOptions(saveOptions);
+  } else {
+    sub->primal();
+  }
+  sub->setPrimalTolerance(saveTolerance);
+  sub->setCurrentPrimalTolerance(saveTolerance);
+  if (!sub->isProvenOptimal() && !sub->isProvenPrimalInfeasible()) {
+    printf("!!!Block %d has bad status %d\n", iBlock, sub->problemStatus());
+    sub->primal(); // last go
+  }
+  //#define WRITE_ALL
+#ifdef WRITE_ALL
+  char name[20];
+  sprintf(name, "pass_%d_block_%d.mps", iPass, iBlock);
+  sub->writeMps(name);
+  sprintf(name, "pass_%d_block_%d.bas", iPass, iBlock);
+  sub->writeBasis(name, true);
+  if (sub->problemStatus() == 1) {
+    sub->readBasis(name);
+    sub->primal();
+  }
+#endif
+  //assert (!sub->numberIterations()||ix!=99);
+}
 // Solve using Benders decomposition and maybe in parallel
 int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
 {
@@ -6320,6 +6714,20 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
   }
 #endif
   int maxPass = options.independentOption(2);
+  /* millions digits are cut options
+     1 - one aggregated optimality cut per pass instead of one per block
+     2,4.. - (value>>1) passes a cut can stay slack before it is deleted
+             (0 only delete when pool full) */
+  int cutOptions = maxPass / 1000000;
+  maxPass -= 1000000 * cutOptions;
+  bool aggregateCuts = (cutOptions & 1) != 0;
+  int cutAge = cutOptions >> 1;
+  // say which proposals are feasibility cuts
+  char *rayCut = new char[numberBlocks];
+  // for adding up optimality cuts
+  double *aggregate = NULL;
+  if (aggregateCuts)
+    aggregate = new double[numberMasterColumns + numberBlocks];
   if (maxPass < 2)
     maxPass = 100;
   int iPass;
@@ -6616,16 +7024,33 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
     int iRow;
     numberRowsGenerated = masterModel.numberRows() - numberMasterRows;
     for (iRow = 0; iRow < numberRowsGenerated; iRow++) {
-      if (masterModel.getStatus(iRow + numberMasterRows) != ClpSimplex::basic)
+      if (masterModel.getRowStatus(iRow + numberMasterRows) != ClpSimplex::basic)
         when[iRow] = iPass;
     }
+    // age cuts - slack for too long or pool full
+    int cutoff = cutAge ? iPass - cutAge - 1 : -1;
     if (numberRowsGenerated > maximumRows - numberBlocks) {
-      // delete
+      // if not enough go for younger slack ones (active ones are always kept)
+      cutoff = CoinMax(cutoff, iPass - 7);
+      int numberOld = 0;
+      for (iRow = 0; iRow < numberRowsGenerated; iRow++) {
+        if (when[iRow] <= cutoff)
+          numberOld++;
+      }
+      while (numberRowsGenerated - numberOld > maximumRows - numberBlocks && cutoff < iPass - 1) {
+        cutoff++;
+        for (iRow = 0; iRow < numberRowsGenerated; iRow++) {
+          if (when[iRow] == cutoff)
+            numberOld++;
+        }
+      }
+    }
+    if (cutoff >= 0) {
       int numberKeep = 0;
       int numberDelete = 0;
       int *whichDelete = new int[numberRowsGenerated];
       for (iRow = 0; iRow < numberRowsGenerated; iRow++) {
-        if (masterModel.getRowStatus(iRow + numberMasterRows) != basic) {
+        if (when[iRow] > cutoff) {
           // keep
           when[numberKeep] = when[iRow];
           whichBlock[numberKeep++] = whichBlock[iRow];
@@ -6634,20 +7059,15 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
           whichDelete[numberDelete++] = iRow + numberMasterRows;
         }
       }
-      if (numberRowsGenerated - numberDelete > maximumRows - numberBlocks) {
-        for (iRow = 0; iRow < numberRowsGenerated; iRow++) {
-          if (when[iRow] > iPass - 7) {
-            // keep
-            when[numberKeep] = when[iRow];
-            whichBlock[numberKeep++] = whichBlock[iRow];
-          } else {
-            // delete
-            whichDelete[numberDelete++] = iRow + numberMasterRows;
-          }
-        }
+      if (numberDelete) {
+        numberRowsGenerated -= numberDelete;
+        masterModel.deleteRows(numberDelete, whichDelete);
+        sprintf(generalPrint, "%d cuts taken out of master, %d left",
+          numberDelete, numberRowsGenerated);
+        handler_->message(CLP_GENERAL2, messages_)
+          << generalPrint
+          << CoinMessageEol;
       }
-      numberRowsGenerated -= numberDelete;
-      masterModel.deleteRows(numberDelete, whichDelete);
       delete[] whichDelete;
     }
     double *primal = NULL;
@@ -6868,117 +7288,20 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
       // mark
       sub[0].setSecondaryStatus(99);
     }
-#ifdef ABC_INHERIT
+#if defined(ABC_INHERIT)
     if (numberCpu < 2) {
+#elif ABOCA_LITE
+    if (abcState() < 2) {
 #endif
-      numberSubInfeasible = 0;
       for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
 #ifdef TRY_NO_SCALING
         sub[iBlock].scaling(0);
 #endif
-        if (sub[iBlock].secondaryStatus() != 99 || false) {
-          //int ix=sub[iBlock].secondaryStatus();
-          int lastStatus = sub[iBlock].problemStatus();
-          // was do dual unless unbounded
-          double saveTolerance = sub[iBlock].primalTolerance();
-          if (lastStatus == 0 || !iPass) {
-            //if (lastStatus<2||!iPass) {
-            //sub[iBlock].dual();
-            sub[iBlock].primal();
-            if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
-              printf("Block %d was feasible now has small infeasibility %g\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities());
-              sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].primal();
-              sub[iBlock].setProblemStatus(0);
-              problemState[iBlock] |= 4; // force actions
-            }
-            if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
-              int n = sub[iBlock].numberIterations();
-              sub[iBlock].scaling(0);
-              sub[iBlock].primal();
-              sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
-              sub[iBlock].scaling(scalingFlag_);
-            }
-          } else if (lastStatus == 1) {
-            // zero out objective
-            double saveScale = sub[iBlock].infeasibilityCost();
-            ClpObjective *saveObjective = sub[iBlock].objectiveAsObject();
-            int numberColumns = sub[iBlock].numberColumns();
-            ClpLinearObjective fake(NULL, numberColumns);
-            sub[iBlock].setObjectivePointer(&fake);
-            int saveOptions = sub[iBlock].specialOptions();
-            sub[iBlock].setSpecialOptions(saveOptions | 8192);
-            sub[iBlock].primal();
-            if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
-              int n = sub[iBlock].numberIterations();
-              sub[iBlock].scaling(0);
-              sub[iBlock].primal();
-              sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
-              sub[iBlock].scaling(scalingFlag_);
-            }
-            sub[iBlock].setObjectivePointer(saveObjective);
-            sub[iBlock].setInfeasibilityCost(saveScale);
-            if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
-              printf("Block %d was infeasible now has small infeasibility %g\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities());
-              sub[iBlock].setProblemStatus(0);
-              sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-            }
-            if (sub[iBlock].isProvenOptimal()) {
-              sub[iBlock].primal();
-              if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
-                int n = sub[iBlock].numberIterations();
-                sub[iBlock].scaling(0);
-                sub[iBlock].primal();
-                sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
-                sub[iBlock].scaling(scalingFlag_);
-              }
-              if (!sub[iBlock].isProvenOptimal()) {
-                printf("Block %d infeasible on second go has small infeasibility %g\n", iBlock,
-                  sub[iBlock].sumPrimalInfeasibilities());
-                sub[iBlock].setProblemStatus(0);
-              }
-              problemState[iBlock] |= 4; // force actions
-            } else {
-              printf("Block %d still infeasible - sum %g - %d iterations\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities(),
-                sub[iBlock].numberIterations());
-              numberSubInfeasible++;
-              if (!sub[iBlock].ray()) {
-                printf("Block %d has no ray!\n", iBlock);
-                sub[iBlock].primal();
-                assert(sub[iBlock].ray()); // otherwise declare optimal
-              }
-            }
-            sub[iBlock].setSpecialOptions(saveOptions);
-          } else {
-            sub[iBlock].primal();
-          }
-          sub[iBlock].setPrimalTolerance(saveTolerance);
-          sub[iBlock].setCurrentPrimalTolerance(saveTolerance);
-          if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenPrimalInfeasible()) {
-            printf("!!!Block %d has bad status %d\n", iBlock, sub[iBlock].problemStatus());
-            sub[iBlock].primal(); // last go
-          }
-          //#define WRITE_ALL
-#ifdef WRITE_ALL
-          char name[20];
-          sprintf(name, "pass_%d_block_%d.mps", iPass, iBlock);
-          sub[iBlock].writeMps(name);
-          sprintf(name, "pass_%d_block_%d.bas", iPass, iBlock);
-          sub[iBlock].writeBasis(name, true);
-          if (sub[iBlock].problemStatus() == 1) {
-            sub[iBlock].readBasis(name);
-            sub[iBlock].primal();
-          }
-#endif
-          //assert (!sub[iBlock].numberIterations()||ix!=99);
-        }
+        if (sub[iBlock].secondaryStatus() != 99)
+          solveBendersBlock(sub + iBlock, iBlock, iPass, maxPass, scalingFlag_,
+            treatSubAsFeasible, problemState[iBlock]);
       }
-#ifdef ABC_INHERIT
+#if defined(ABC_INHERIT)
     } else {
       int iBlock = 0;
       while (iBlock < numberBlocks) {
@@ -6995,7 +7318,27 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
       }
       threadInfo.waitAllTasks();
     }
+#elif ABOCA_LITE
+    } else {
+      // scenarios are independent - each only touches its own state
+      for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+#ifdef TRY_NO_SCALING
+        sub[iBlock].scaling(0);
+#endif
+        if (sub[iBlock].secondaryStatus() != 99)
+          cilk_spawn solveBendersBlock(sub + iBlock, iBlock, iPass, maxPass,
+            scalingFlag_, treatSubAsFeasible, problemState[iBlock]);
+      }
+      cilk_sync;
+    }
 #endif
+    numberSubInfeasible = 0;
+    for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+      if ((problemState[iBlock] & 8) != 0) {
+        numberSubInfeasible++;
+        problemState[iBlock] &= ~8;
+      }
+    }
     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
       if (!iPass)
         problemState[iBlock] |= 4; // force actions
@@ -7235,6 +7578,7 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
               if (logLevel > 1)
                 printf("Cut for block %d has %d elements\n", iBlock, number - 1 - start);
               blockPrint[numberProposals] = iBlock;
+              rayCut[numberProposals] = 0;
               objective[numberProposals] = -objValue;
               rowAdd[++numberProposals] = number;
               when[numberRowsGenerated] = iPass;
@@ -7614,6 +7958,7 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
               if (logLevel > 1)
                 printf("Cut for block %d has %d elements (infeasibility)\n", iBlock, number - start);
               blockPrint[numberProposals] = iBlock;
+              rayCut[numberProposals] = 1;
               // take
               objective[numberProposals] = objValue;
               rowAdd[++numberProposals] = number;
@@ -7629,6 +7974,63 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
       }
       problemState[iBlock] &= ~4;
     }
+    if (aggregateCuts && numberProposals > 1) {
+      // one optimality cut (on sum of thetas) - feasibility cuts stay as they are
+      int numberOptimality = 0;
+      for (int i = 0; i < numberProposals; i++) {
+        if (!rayCut[i])
+          numberOptimality++;
+      }
+      if (numberOptimality > 1) {
+        numberRowsGenerated -= numberProposals;
+        CoinZeroN(aggregate, numberMasterColumns + numberBlocks);
+        double rhs = 0.0;
+        int firstBlock = -1;
+        int numberCuts = 0;
+        CoinBigIndex put = 0;
+        CoinBigIndex nextStart = 0;
+        for (int i = 0; i < numberProposals; i++) {
+          CoinBigIndex start = nextStart;
+          nextStart = rowAdd[i + 1];
+          if (rayCut[i]) {
+            // move down
+            for (CoinBigIndex j = start; j < nextStart; j++) {
+              indexColumnAdd[put] = indexColumnAdd[j];
+              elementAdd[put++] = elementAdd[j];
+            }
+            blockPrint[numberCuts] = blockPrint[i];
+            rayCut[numberCuts] = 1;
+            objective[numberCuts++] = objective[i];
+            rowAdd[numberCuts] = put;
+            when[numberRowsGenerated] = iPass;
+            whichBlock[numberRowsGenerated++] = blockPrint[i];
+          } else {
+            for (CoinBigIndex j = start; j < nextStart; j++)
+              aggregate[indexColumnAdd[j]] += elementAdd[j];
+            rhs += objective[i];
+            if (firstBlock < 0)
+              firstBlock = blockPrint[i];
+          }
+        }
+        for (int i = 0; i < numberMasterColumns + numberBlocks; i++) {
+          double value = aggregate[i];
+          if (fabs(value) > 1.0e-12) {
+            indexColumnAdd[put] = i;
+            elementAdd[put++] = value;
+          }
+        }
+        blockPrint[numberCuts] = firstBlock;
+        rayCut[numberCuts] = 0;
+        objective[numberCuts++] = rhs;
+        rowAdd[numberCuts] = put;
+        when[numberRowsGenerated] = iPass;
+        whichBlock[numberRowsGenerated++] = -1; // all blocks
+        if (logLevel > 1)
+          printf("%d optimality cuts aggregated into one with %d elements\n",
+            numberOptimality, static_cast< int >(put - rowAdd[numberCuts - 1]));
+        numberProposals = numberCuts;
+      }
+    }
     if (deletePrimal)
       delete[] primal;
     if (numberProposals) {
@@ -7940,6 +8342,8 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
   //delete [] upper;
   delete[] whichBlock;
   delete[] when;
+  delete[] rayCut;
+  delete[] aggregate;
   delete[] rowAdd;
   delete[] columnAdd;
   delete[] elementAdd;
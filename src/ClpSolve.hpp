@@ -86,6 +86,10 @@ public:
        	   11 - no nothing and primal(0)
          2 - interrupt handling - 0 yes, 1 no (for threadsafe)
          3 - whether to make +- 1matrix - 0 yes, 1 no
+                      add 2 - automatic looks for bordered block structure
+                      and uses Dantzig-Wolfe or Benders if border small
+                      add 4 - do not use network simplex on network matrix
+                      (+- 1 matrix is only made if whole option is 0)
          4 - for barrier
                       0 - dense cholesky
        	   1 - Wssmp allowing some long columns
@@ -95,6 +99,7 @@ public:
        	   8 - bit set to do scaling
        	   16 - set to be aggressive with gamma/delta?
                       32 - Use KKT
+                      8192 - bulk crossover basis (see ClpSimplexOther)
          5 - for presolve
                       1 - switch off dual stuff
          6 - extra switches
@@ -300,6 +305,8 @@ private:
          1 - To be copied over to presolve options
          2 - max substitution level
 	 If Dantzig Wolfe/benders 0 is number blocks, 2 is #passes (notional)
+	 For benders millions digits of 2 are cut options - 1 one aggregated
+	 optimality cut per pass, rest (>>1) passes a slack cut is kept
      */
   int independentOptions_[3];
   //@}
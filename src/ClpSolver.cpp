@@ -56,6 +56,7 @@
 #include "ClpFactorization.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpNetworkMatrix.hpp"
+#include "ClpGainNetworkMatrix.hpp"
 #include "ClpPEDualRowDantzig.hpp"
 #include "ClpPEDualRowSteepest.hpp"
 #include "ClpPEPrimalColumnDantzig.hpp"
@@ -760,16 +761,20 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
           model_.factorization()->setForrestTomlin(mode == 0);
           break;
         case ClpParam::FACTORIZATION:
-          model_.factorization()->forceOtherFactorization(mode);
-#ifdef ABC_INHERIT
-          model_.factorization()->forceOtherFactorization(mode);
-#endif
+          // 4 is automatic choice
+          model_.factorization()->setBackend(mode);
           break;
         case ClpParam::CRASH:
           doCrash = mode;
           break;
         case ClpParam::VECTOR:
           doVector = mode;
+#ifndef COIN_AVX2
+          if (mode == 2)
+#else
+          if (mode == 3)
+#endif
+            doVector = 10; // pool matrix - see ClpSimplex::initialSolve
           break;
         case ClpParam::MESSAGES:
           model_.messageHandler()->setPrefix(mode != 0);
@@ -1018,7 +1023,7 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
           if (doVector) {
             model_.setVectorMode(doVector);
             ClpMatrixBase *matrix = model_.clpMatrix();
-            if (dynamic_cast<ClpPackedMatrix *>(matrix)) {
+            if (doVector < 10 && dynamic_cast<ClpPackedMatrix *>(matrix)) {
               ClpPackedMatrix *clpMatrix =
                   dynamic_cast<ClpPackedMatrix *>(matrix);
               clpMatrix->makeSpecialColumnCopy();
@@ -1413,8 +1418,20 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
               printGeneralMessage(model_,
                                   "Matrix converted to network matrix\n");
             } else {
-              printGeneralWarning(
+              delete newMatrix;
+              // try network with gains
+              ClpGainNetworkMatrix *gainMatrix =
+                  new ClpGainNetworkMatrix(*(clpMatrix->matrix()));
+              if (gainMatrix->getIndices()) {
+                model_.replaceMatrix(gainMatrix);
+                delete saveMatrix;
+                printGeneralMessage(model_,
+                   "Matrix converted to generalized network matrix\n");
+              } else {
+                delete gainMatrix;
+                printGeneralWarning(
                   model_, "Matrix can not be converted to network matrix\n");
+              }
             }
           } else {
             printGeneralWarning(model_, "Matrix not a ClpPackedMatrix\n");
@@ -12,6 +12,100 @@
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
 #include "CoinFinite.hpp"
+#if ABC_PARALLEL == 2
+/* Takes pivot row element out of columns in row entries first to last-1
+   for a column singleton pivot.  Each entry is a different column so
+   ranges can be done in parallel - count links are done before (in order) */
+static void singletonColumnBit(CoinBigIndex first, CoinBigIndex last, int giveUp,
+  CoinSimplexInt iPivotRow, CoinSimplexInt iPivotColumn, CoinSimplexInt putRow,
+  const CoinSimplexInt *COIN_RESTRICT indexColumn, CoinSimplexInt *COIN_RESTRICT indexRow,
+  CoinFactorizationDouble *COIN_RESTRICT element, CoinBigIndex *COIN_RESTRICT startColumn,
+  CoinSimplexInt *COIN_RESTRICT numberInColumn, CoinSimplexInt *COIN_RESTRICT numberInColumnPlus,
+  CoinBigIndex *COIN_RESTRICT convertRowToColumn, CoinBigIndex *COIN_RESTRICT convertColumnToRow)
+{
+  if (last - first > giveUp) {
+    CoinBigIndex mid = (last + first) >> 1;
+    cilk_spawn singletonColumnBit(first, mid, giveUp, iPivotRow, iPivotColumn, putRow,
+      indexColumn, indexRow, element, startColumn, numberInColumn, numberInColumnPlus,
+      convertRowToColumn, convertColumnToRow);
+    singletonColumnBit(mid, last, giveUp, iPivotRow, iPivotColumn, putRow,
+      indexColumn, indexRow, element, startColumn, numberInColumn, numberInColumnPlus,
+      convertRowToColumn, convertColumnToRow);
+    cilk_sync;
+    return;
+  }
+  for (CoinBigIndex i = first; i < last; i++) {
+    CoinSimplexInt iColumn = indexColumn[i];
+    if (iColumn == iPivotColumn)
+      continue;
+    CoinSimplexInt number = numberInColumn[iColumn] - 1;
+    CoinBigIndex start = startColumn[iColumn];
+    //move pivot row element
+    if (number) {
+#if CONVERTROW < 2
+      CoinBigIndex pivot = start;
+      while (indexRow[pivot] != iPivotRow)
+        pivot++;
+#else
+      CoinBigIndex pivot = convertRowToColumn[i];
+#endif
+      if (pivot != start) {
+        //move largest one up
+        CoinFactorizationDouble value = element[start];
+        int iRow = indexRow[start];
+        element[start] = element[pivot];
+        indexRow[start] = indexRow[pivot];
+        element[pivot] = element[start + 1];
+        indexRow[pivot] = indexRow[start + 1];
+#if CONVERTROW > 1
+        CoinBigIndex whereRowEntry = convertColumnToRow[start + 1];
+        CoinBigIndex whereRowEntry2 = convertColumnToRow[start];
+        convertRowToColumn[whereRowEntry] = pivot;
+        convertColumnToRow[pivot] = whereRowEntry;
+        convertRowToColumn[whereRowEntry2] = start + 1;
+        convertColumnToRow[start + 1] = whereRowEntry2;
+#endif
+        element[start + 1] = value;
+        indexRow[start + 1] = iRow;
+      } else {
+        //find new largest element
+        CoinSimplexInt iRowSave = indexRow[start + 1];
+        CoinFactorizationDouble valueSave = element[start + 1];
+        CoinFactorizationDouble valueLargest = fabs(valueSave);
+        CoinBigIndex end = start + numberInColumn[iColumn];
+        CoinBigIndex largest = start + 1;
+        for (CoinBigIndex k = start + 2; k < end; k++) {
+          CoinFactorizationDouble value = element[k];
+          CoinFactorizationDouble valueAbs = fabs(value);
+          if (valueAbs > valueLargest) {
+            valueLargest = valueAbs;
+            largest = k;
+          }
+        }
+        indexRow[start + 1] = indexRow[largest];
+        element[start + 1] = element[largest];
+#if CONVERTROW > 1
+        CoinBigIndex whereRowEntry = convertColumnToRow[largest];
+        CoinBigIndex whereRowEntry2 = convertColumnToRow[start + 1];
+        convertRowToColumn[whereRowEntry] = start + 1;
+        convertColumnToRow[start + 1] = whereRowEntry;
+        convertRowToColumn[whereRowEntry2] = largest;
+        convertColumnToRow[largest] = whereRowEntry2;
+#endif
+        indexRow[largest] = iRowSave;
+        element[largest] = valueSave;
+      }
+    }
+    //clean up counts
+    numberInColumn[iColumn]--;
+    numberInColumnPlus[iColumn]++;
+#ifdef SMALL_PERMUTE
+    indexRow[start] = putRow;
+#endif
+    startColumn[iColumn]++;
+  }
+}
+#endif
 //  factorSparse.  Does sparse phase of factorization
 //return code is <0 error, 0= finished
 CoinSimplexInt
@@ -192,6 +286,31 @@ CoinAbcTypeFactorization::factorSparse()
         CoinBigIndex endR = startR + numberDoRow;
         //clean up counts
         pivotMultiplier = 1.0 / element[startC];
+#if ABC_PARALLEL == 2
+        if (parallelMode_ && numberDoRow > 1000) {
+          // links in order (so deterministic) then columns in parallel
+          for (CoinBigIndex i = startR; i < endR; i++) {
+            CoinSimplexInt iColumn = indexColumn[i];
+            if (iColumn != iPivotColumn)
+              modifyLink(iColumn + numberRows_, numberInColumn[iColumn] - 1);
+          }
+          int giveUp = CoinMax(numberDoRow / (parallelMode_ + 1 + (parallelMode_ >> 1)), 256);
+#ifdef SMALL_PERMUTE
+          CoinSimplexInt putRow = realPivotRow;
+#else
+          CoinSimplexInt putRow = iPivotRow;
+#endif
+#if CONVERTROW > 1
+          singletonColumnBit(startR, endR, giveUp, iPivotRow, iPivotColumn, putRow,
+            indexColumn, indexRow, element, startColumn, numberInColumn, numberInColumnPlus,
+            convertRowToColumn, convertColumnToRow);
+#else
+          singletonColumnBit(startR, endR, giveUp, iPivotRow, iPivotColumn, putRow,
+            indexColumn, indexRow, element, startColumn, numberInColumn, numberInColumnPlus,
+            NULL, NULL);
+#endif
+        } else
+#endif
         // would I be better off doing other way first??
         for (CoinBigIndex i = startR; i < endR; i++) {
           CoinSimplexInt iColumn = indexColumn[i];
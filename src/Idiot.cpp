@@ -20,6 +20,7 @@
 // Redefine stuff for Clp
 #ifndef OSI_IDIOT
 #include "ClpMessage.hpp"
+#include "ClpSimplexOther.hpp"
 #define OsiObjOffset ClpObjOffset
 #endif
 /**** strategy 4 - drop, exitDrop and djTolerance all relative:
@@ -1805,6 +1806,31 @@ void Idiot::crossOver(int mode)
     }
     /*printf("%d in basis\n",ninbas);*/
   }
+  if ((strategy_ & 1048576) != 0 && addAll < 3) {
+    // bulk crossover - restore bounds and build basis in one go
+    if (saveUpper) {
+      CoinMemcpyN(saveUpper, ncols, upper);
+      CoinMemcpyN(saveLower, ncols, lower);
+      delete[] saveUpper;
+      delete[] saveLower;
+    }
+    delete[] saveRowUpper;
+    delete[] saveRowLower;
+    ClpSimplexOther *other = static_cast< ClpSimplexOther * >(model_);
+    other->bulkCrossoverBasis(fixTolerance);
+    if (!justValuesPass)
+      other->parallelCrossoverCleanup();
+    else
+      model_->primal(2);
+#ifdef COIN_DEVELOP
+    printf("Total time in crossover %g\n", CoinCpuTime() - startTime);
+#endif
+#ifdef FEB_TRY
+    model_->setSpecialOptions(saveOptions);
+    model_->setPerturbation(savePerturbation);
+#endif
+    return;
+  }
   bool wantVector = false;
   if (dynamic_cast< ClpPackedMatrix * >(model_->clpMatrix())) {
     // See if original wanted vector
@@ -328,7 +328,9 @@ private:
 		 65536 - experimental 2
 		 131072 - experimental 3 
 		 262144 - just values pass etc 
-		 524288 - don't treat structural slacks as slacks */
+		 524288 - don't treat structural slacks as slacks
+		 1048576 - bulk crossover (basis from blocks of superbasics
+		           in one factorization then primal/dual race) */
 
   int lightWeight_; // 0 - normal, 1 lightweight
 };
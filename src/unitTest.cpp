@@ -31,6 +31,10 @@
 #include "CoinAbcFactorization.hpp"
 #endif
 #include "ClpFactorization.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
@@ -43,6 +47,9 @@
 #include "ClpModelParameters.hpp"
 #include "ClpNetworkMatrix.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
+#include "ClpLowRankObjective.hpp"
+#include "ClpGainNetworkMatrix.hpp"
+#include "ClpSimplexNetwork.hpp"
 #include "MyMessageHandler.hpp"
 #include "MyEventHandler.hpp"
 
@@ -2687,6 +2694,364 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     }
   }
 #endif
+  // Test bulk crossover and cleanup (primal/dual race if threads)
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.status() == 0);
+      int numberColumns = model.numberColumns();
+      int numberRows = model.numberRows();
+      // optimal values but no basis
+      CoinMemcpyN(model.primalColumnSolution(), numberColumns,
+        model2.primalColumnSolution());
+      CoinMemcpyN(model.primalRowSolution(), numberRows,
+        model2.primalRowSolution());
+      model2.createStatus();
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        model2.setColumnStatus(iColumn, ClpSimplex::superBasic);
+      ClpSimplexOther *other = static_cast< ClpSimplexOther * >(&model2);
+      other->bulkCrossoverBasis(1.0e-7);
+      int status = other->parallelCrossoverCleanup();
+      assert(status == 0);
+      assert(model2.status() == 0);
+      CoinRelFltEq eq(1.0e-8);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    } else {
+      std::cerr << "Error reading afiro.mps. Skipping test." << std::endl;
+    }
+  }
+  // Test early factorization
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.status() == 0);
+      // short cycles so early factorization is used several times
+      model2.factorization()->maximumPivots(8);
+      model2.setEarlyFactorization(3);
+#if ABOCA_LITE
+      // early factorization is only started with threads
+#ifdef ABC_INHERIT
+      int saveState = model2.abcState();
+      model2.setAbcState(2);
+#else
+      int saveState = abcState();
+      setAbcState(2);
+#endif
+#endif
+      model2.dual();
+      assert(model2.status() == 0);
+      CoinRelFltEq eq(1.0e-8);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+      // and again from slack basis with primal
+      model2.allSlackBasis(true);
+      model2.primal();
+      assert(model2.status() == 0);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+#if ABOCA_LITE
+#ifdef ABC_INHERIT
+      model2.setAbcState(saveState);
+#else
+      setAbcState(saveState);
+#endif
+#endif
+    } else {
+      std::cerr << "Error reading afiro.mps. Skipping test." << std::endl;
+    }
+  }
+  // Test lazy reduced costs
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.status() == 0);
+      // any number of changed duals allowed so lazy pass always tried
+      model2.setLazyDuals(5, 1.0);
+      model2.setPerturbation(50);
+      model2.dual();
+      assert(model2.status() == 0);
+      CoinRelFltEq eq(1.0e-8);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+      // reduced costs must match cost minus duals times matrix
+      int numberColumns = model2.numberColumns();
+      double *dj = new double[numberColumns];
+      CoinZeroN(dj, numberColumns);
+      m.getMatrixByCol()->transposeTimes(model2.dualRowSolution(), dj);
+      const double *objective = m.getObjCoefficients();
+      const double *reducedCost = model2.dualColumnSolution();
+      for (int i = 0; i < numberColumns; i++) {
+        double value = objective[i] - dj[i];
+        assert(fabs(value - reducedCost[i]) < 1.0e-6 * (1.0 + fabs(value)));
+      }
+      delete[] dj;
+    } else {
+      std::cerr << "Error reading brandy.mps. Skipping test." << std::endl;
+    }
+  }
+  // Test network simplex against dual
+  {
+    // arcs from, to
+    int from[5] = { 0, 0, 1, 1, 2 };
+    int to[5] = { 1, 2, 2, 3, 3 };
+    double cost[5] = { 4.0, 2.0, 1.0, 6.0, 3.0 };
+    double columnLower[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    double columnUpper[5] = { 8.0, 5.0, 10.0, 6.0, 10.0 };
+    double rowLower[4] = { -10.0, 0.0, 0.0, 10.0 };
+    double rowUpper[4] = { -10.0, 0.0, 0.0, 10.0 };
+    CoinBigIndex start[6] = { 0, 2, 4, 6, 8, 10 };
+    int length[5] = { 2, 2, 2, 2, 2 };
+    int row[10];
+    double element[10];
+    for (int i = 0; i < 5; i++) {
+      row[2 * i] = from[i];
+      element[2 * i] = -1.0;
+      row[2 * i + 1] = to[i];
+      element[2 * i + 1] = 1.0;
+    }
+    CoinPackedMatrix matrix(true, 4, 5, 10, element, row, start, length);
+    ClpSimplex model;
+    model.loadProblem(matrix, columnLower, columnUpper, cost,
+      rowLower, rowUpper);
+    model.dual();
+    assert(model.status() == 0);
+    CoinRelFltEq eq(1.0e-8);
+    ClpNetworkMatrix network(5, from, to);
+    ClpSimplex model2;
+    model2.loadProblem(network, columnLower, columnUpper, cost,
+      rowLower, rowUpper);
+    int status = static_cast< ClpSimplexNetwork * >(&model2)->network();
+    assert(status == 0);
+    assert(eq(model2.objectiveValue(), model.objectiveValue()));
+  }
+  // Test generalized network matrix against dual
+  {
+    // arcs from, to
+    int from[5] = { 0, 0, 1, 1, 2 };
+    int to[5] = { 1, 2, 2, 3, 3 };
+    double cost[5] = { 4.0, 2.0, 1.0, 6.0, 3.0 };
+    double columnLower[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    double columnUpper[5] = { 8.0, 5.0, 10.0, 6.0, 10.0 };
+    // send at most 10 and deliver at least 6
+    double rowLower[4] = { -10.0, 0.0, 0.0, 6.0 };
+    double rowUpper[4] = { 0.0, 0.0, 0.0, COIN_DBL_MAX };
+    double gain[5] = { 0.9, 0.8, 1.0, 0.95, 0.9 };
+    CoinBigIndex start[6] = { 0, 2, 4, 6, 8, 10 };
+    int length[5] = { 2, 2, 2, 2, 2 };
+    int row[10];
+    double element[10];
+    for (int i = 0; i < 5; i++) {
+      row[2 * i] = from[i];
+      element[2 * i] = -1.0;
+      row[2 * i + 1] = to[i];
+      element[2 * i + 1] = gain[i];
+    }
+    CoinPackedMatrix matrix(true, 4, 5, 10, element, row, start, length);
+    ClpSimplex model;
+    model.loadProblem(matrix, columnLower, columnUpper, cost,
+      rowLower, rowUpper);
+    model.dual();
+    assert(model.status() == 0);
+    CoinRelFltEq eq(1.0e-8);
+    ClpGainNetworkMatrix gainNetwork(5, to, from, gain);
+    ClpSimplex model2;
+    model2.loadProblem(gainNetwork, columnLower, columnUpper, cost,
+      rowLower, rowUpper);
+    model2.dual();
+    assert(model2.status() == 0);
+    assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    model2.allSlackBasis(true);
+    model2.primal();
+    assert(model2.status() == 0);
+    assert(eq(model2.objectiveValue(), model.objectiveValue()));
+  }
+  // Test low rank objective against same quadratic objective
+  {
+    double objective[3] = { -1.0, -2.0, -1.0 };
+    double columnLower[3] = { 0.0, 0.0, 0.0 };
+    double columnUpper[3] = { 10.0, 10.0, 10.0 };
+    double rowLower[1] = { -COIN_DBL_MAX };
+    double rowUpper[1] = { 4.0 };
+    CoinBigIndex start[4] = { 0, 1, 2, 3 };
+    int length[3] = { 1, 1, 1 };
+    int row[3] = { 0, 0, 0 };
+    double element[3] = { 1.0, 1.0, 1.0 };
+    CoinPackedMatrix matrix(true, 1, 3, 3, element, row, start, length);
+    // Q is f*f' + diagonal - upper triangle by column
+    double factors[3] = { 1.0, 0.5, 1.0 };
+    double diagonal[3] = { 1.0, 1.0, 1.0 };
+    int startQ[4];
+    int columnQ[6];
+    double elementQ[6];
+    int n = 0;
+    for (int i = 0; i < 3; i++) {
+      startQ[i] = n;
+      for (int j = i; j < 3; j++) {
+        columnQ[n] = j;
+        elementQ[n++] = factors[i] * factors[j] + ((i == j) ? diagonal[i] : 0.0);
+      }
+    }
+    startQ[3] = n;
+    ClpSimplex model;
+    model.loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    model.loadQuadraticObjective(3, startQ, columnQ, elementQ);
+    model.primal();
+    assert(model.status() == 0);
+    ClpSimplex model2;
+    model2.loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    ClpLowRankObjective lowRank(objective, 3, 1, factors, diagonal);
+    model2.setObjective(&lowRank);
+    model2.primal();
+    assert(model2.status() == 0);
+    CoinRelFltEq eq(1.0e-6);
+    assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    // initialSolve must not go to dual or barrier
+    model2.allSlackBasis(true);
+    model2.initialSolve();
+    assert(model2.status() == 0);
+    assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    // extra linear column which presolve can remove
+    double objective4[4] = { -1.0, -2.0, -1.0, 1.0 };
+    double columnLower4[4] = { 0.0, 0.0, 0.0, 0.0 };
+    double columnUpper4[4] = { 10.0, 10.0, 10.0, 10.0 };
+    CoinBigIndex start4[5] = { 0, 1, 2, 3, 4 };
+    int length4[4] = { 1, 1, 1, 1 };
+    int row4[4] = { 0, 0, 0, 0 };
+    double element4[4] = { 1.0, 1.0, 1.0, 1.0 };
+    CoinPackedMatrix matrix4(true, 1, 4, 4, element4, row4, start4, length4);
+    double factors4[4] = { 1.0, 0.5, 1.0, 0.0 };
+    double diagonal4[4] = { 1.0, 1.0, 1.0, 0.0 };
+    ClpSimplex model3;
+    model3.loadProblem(matrix4, columnLower4, columnUpper4, objective4,
+      rowLower, rowUpper);
+    ClpLowRankObjective lowRank4(objective4, 4, 1, factors4, diagonal4);
+    model3.setObjective(&lowRank4);
+    ClpPresolve pinfo;
+    ClpSimplex *model4 = pinfo.presolvedModel(model3, 1.0e-8);
+    assert(model4);
+    // low rank term must survive presolve
+    assert(model4->objectiveAsObject()->type() == 3);
+    model4->primal();
+    assert(model4->status() == 0);
+    pinfo.postsolve(true);
+    delete model4;
+    model3.primal(1);
+    assert(model3.status() == 0);
+    assert(eq(model3.objectiveValue(), model.objectiveValue()));
+  }
+#if CLP_POOL_MATRIX
+  // Test pool matrix against dual
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.dual();
+      assert(model.status() == 0);
+      ClpPoolMatrix pool(*m.getMatrixByCol());
+      // -1 columns if too many different values
+      if (pool.getNumCols() == model.numberColumns()) {
+        ClpSimplex model2;
+        model2.loadProblem(pool, m.getColLower(), m.getColUpper(),
+          m.getObjCoefficients(),
+          m.getRowLower(), m.getRowUpper());
+        model2.dual();
+        assert(model2.status() == 0);
+        CoinRelFltEq eq(1.0e-8);
+        assert(eq(model2.objectiveValue(), model.objectiveValue()));
+        model2.allSlackBasis(true);
+        model2.primal();
+        assert(model2.status() == 0);
+        assert(eq(model2.objectiveValue(), model.objectiveValue()));
+      }
+    } else {
+      std::cerr << "Error reading afiro.mps. Skipping test." << std::endl;
+    }
+  }
+#endif
+  // Test decomposition of maximization problem against dual
+  {
+    CoinRelFltEq eq(1.0e-7);
+    // Dantzig-Wolfe - two blocks and one linking row
+    {
+      double objective[4] = { 3.0, 2.0, 2.0, 4.0 };
+      double columnLower[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double columnUpper[4] = { 10.0, 10.0, 10.0, 10.0 };
+      double rowLower[3] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX };
+      double rowUpper[3] = { 4.0, 6.0, 7.0 };
+      CoinBigIndex start[5] = { 0, 2, 4, 6, 8 };
+      int length[4] = { 2, 2, 2, 2 };
+      int row[8] = { 0, 2, 0, 2, 1, 2, 1, 2 };
+      double element[8] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 2.0, 1.0 };
+      CoinPackedMatrix matrix(true, 3, 4, 8, element, row, start, length);
+      ClpSimplex model;
+      model.loadProblem(matrix, columnLower, columnUpper, objective,
+        rowLower, rowUpper);
+      model.setOptimizationDirection(-1.0);
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.status() == 0);
+      int rowBlock[3] = { 0, 1, -1 };
+      int columnBlock[4] = { 0, 0, 1, 1 };
+      CoinStructuredModel *structured = static_cast< ClpSimplexOther * >(&model2)->structuredModel(1, 2, rowBlock, columnBlock);
+      ClpSolve options;
+      model2.solveDW(structured, options);
+      delete structured;
+      assert(model2.status() == 0);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    }
+    // Benders - two blocks and one linking column
+    {
+      double objective[5] = { 3.0, 2.0, 2.0, 4.0, 5.0 };
+      double columnLower[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+      double columnUpper[5] = { 10.0, 10.0, 10.0, 10.0, 10.0 };
+      double rowLower[2] = { -COIN_DBL_MAX, -COIN_DBL_MAX };
+      double rowUpper[2] = { 4.0, 6.0 };
+      CoinBigIndex start[6] = { 0, 1, 2, 3, 4, 6 };
+      int length[5] = { 1, 1, 1, 1, 2 };
+      int row[6] = { 0, 0, 1, 1, 0, 1 };
+      double element[6] = { 1.0, 1.0, 1.0, 2.0, 1.0, 1.0 };
+      CoinPackedMatrix matrix(true, 2, 5, 6, element, row, start, length);
+      ClpSimplex model;
+      model.loadProblem(matrix, columnLower, columnUpper, objective,
+        rowLower, rowUpper);
+      model.setOptimizationDirection(-1.0);
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.status() == 0);
+      int rowBlock[2] = { 0, 1 };
+      int columnBlock[5] = { 0, 0, 1, 1, -1 };
+      CoinStructuredModel *structured = static_cast< ClpSimplexOther * >(&model2)->structuredModel(2, 2, rowBlock, columnBlock);
+      ClpSolve options;
+      model2.solveBenders(structured, options);
+      delete structured;
+      assert(model2.status() == 0);
+      assert(eq(model2.objectiveValue(), model.objectiveValue()));
+    }
+  }
   // Test CoinStructuredModel
   {
 